@@ -0,0 +1,722 @@
+// -------------------------------------------------------------------------------------------
+// Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
+// This file is part of the VSF GCCG API, licensed under the BSD 2-Clause "Simplified" License.
+// License details at: https://github.com/vsf-tv/gccg-api/blob/mainline/LICENSE
+// -------------------------------------------------------------------------------------------
+
+/**
+ * @file
+ * @brief
+ * Reference benchmark for implementations of the GCCG transport API. It only uses the public API declared in
+ * gccg_transport_api.h, so it can be built against any implementation and used to compare them or to track regressions.
+ *
+ * The benchmark runs in one of three modes:
+ * - loopback: a receiver and a transmitter are created in the same process and payloads are sent from one to the other.
+ * - tx: only the transmitter is created. Use together with a second instance running in rx mode on another host.
+ * - rx: only the receiver is created.
+ *
+ * Results are written to stdout in text or json format. See README.md for usage.
+ **/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "../gccg_transport_api.h"
+#include "../gccg_anc_utils.h"
+
+#define MAX_FLOW_COUNT 8
+#define MAX_LATENCY_SAMPLES (1 << 22)
+#define JSON_BUFFER_SIZE 16384
+
+/// @brief Media flow presets selectable using the --flow option.
+typedef struct {
+    const char* name_str;
+    const char* media_element_json_str;
+    int size_in_bytes;
+} FlowPreset;
+
+static const FlowPreset kFlowPresets[] = {
+    { "1080p",
+      "{\"type\":\"video\",\"encodingName\":\"raw\",\"clockRate\":90000,\"videoAttributes\":{\"sampling\":\"YCbCr-4:2:2\","
+      "\"depth\":10,\"width\":1920,\"height\":1080,\"exactframerate\":\"60000/1001\",\"colorimetry\":\"BT709\","
+      "\"interlace\":false,\"TCS\":\"SDR\",\"RANGE\":\"NARROW\"}}",
+      1920 * 1080 * 5 / 2 },
+    { "uhd",
+      "{\"type\":\"video\",\"encodingName\":\"raw\",\"clockRate\":90000,\"videoAttributes\":{\"sampling\":\"YCbCr-4:2:2\","
+      "\"depth\":10,\"width\":3840,\"height\":2160,\"exactframerate\":\"60000/1001\",\"colorimetry\":\"BT2020\","
+      "\"interlace\":false,\"TCS\":\"HLG\",\"RANGE\":\"NARROW\"}}",
+      3840 * 2160 * 5 / 2 },
+    { "pcm16",
+      "{\"type\":\"audio\",\"encodingName\":\"pcm\",\"clockRate\":48000,\"audioAttributes\":{\"totalChannels\":16,"
+      "\"activeChannels\":16,\"channelOrder\":\"SMPTE2110.(SGRP)\",\"depth\":24,\"sampleCount\":801}}",
+      16 * 801 * 4 },
+    { "anc",
+      "{\"type\":\"ancillary-data\",\"encodingName\":\"smpte291\",\"ancillaryDataAttributes\":{\"encodingName\":"
+      "\"rfc8331\",\"packetCount\":0}}",
+      1024 },
+};
+
+/// @brief Options parsed from the command line.
+typedef struct {
+    const char* mode_str;
+    const FlowPreset* flow_array[MAX_FLOW_COUNT];
+    int flow_count;
+    const char* tx_transport_json_str;
+    const char* rx_transport_json_str;
+    int thread_count;
+    int event_loop;
+    double duration_secs;
+    double rate_hz;
+    int inflight_count;
+    int timeout_microsecs;
+    int json_output;
+} BenchmarkOptions;
+
+/// @brief Counters and latency samples of one direction. Updated from the callback functions.
+typedef struct {
+    pthread_mutex_t mutex;
+    uint64_t payloads;
+    uint64_t bytes;
+    uint64_t timeouts;
+    uint64_t errors;
+    uint64_t latency_count;
+    uint64_t* latency_array; ///< Latency samples in nanoseconds, a uniform random sample of all measurements.
+    uint64_t latency_measured_count; ///< Number of latency measurements, including those not kept in latency_array.
+    uint64_t latency_maximum; ///< Largest latency measured, in nanoseconds.
+    uint64_t random_state;
+} DirectionStats;
+
+/// @brief State of a transmitter. Payload buffers are handed out from a stack of free slots.
+typedef struct {
+    GccgConnectionHandle handle;
+    char* buffer_ptr;
+    int payload_size_bytes;
+    int payload_data_bytes; ///< Bytes of media element data sent per payload, at most payload_size_bytes.
+    pthread_mutex_t mutex;
+    int free_count;
+    int* free_array;
+    uint64_t* submit_time_array;
+    GccgMediaElement* element_array;
+    GccgMediaElement** element_ptr_array;
+} TxState;
+
+static DirectionStats g_tx_stats;
+static DirectionStats g_rx_stats;
+static TxState g_tx;
+
+/// @brief Current time of the SDK clock used for COT and LAT timestamps, in nanoseconds since the SMPTE Epoch.
+static uint64_t ClockSdkNanosecs(void)
+{
+    GccgTimestamp timestamp;
+    GccgClockNow(&timestamp);
+    return (uint64_t)timestamp.seconds * 1000000000ull + timestamp.nanoseconds;
+}
+
+static uint64_t ClockMonotonicNanosecs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void SleepNanosecs(uint64_t nanosecs)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t)(nanosecs / 1000000000ull);
+    ts.tv_nsec = (long)(nanosecs % 1000000000ull);
+    nanosleep(&ts, NULL);
+}
+
+static double CpuSeconds(void)
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (double)usage.ru_utime.tv_sec + (double)usage.ru_utime.tv_usec / 1e6 +
+           (double)usage.ru_stime.tv_sec + (double)usage.ru_stime.tv_usec / 1e6;
+}
+
+static char* ReadFile(const char* path_str)
+{
+    FILE* file_ptr = fopen(path_str, "rb");
+    if (file_ptr == NULL) {
+        fprintf(stderr, "Unable to open %s\n", path_str);
+        exit(EXIT_FAILURE);
+    }
+    fseek(file_ptr, 0, SEEK_END);
+    long size = ftell(file_ptr);
+    fseek(file_ptr, 0, SEEK_SET);
+    char* data_ptr = malloc((size_t)size + 1);
+    if (data_ptr == NULL || fread(data_ptr, 1, (size_t)size, file_ptr) != (size_t)size) {
+        fprintf(stderr, "Unable to read %s\n", path_str);
+        exit(EXIT_FAILURE);
+    }
+    data_ptr[size] = '\0';
+    fclose(file_ptr);
+    return data_ptr;
+}
+
+static void DirectionStatsInit(DirectionStats* stats_ptr)
+{
+    memset(stats_ptr, 0, sizeof(*stats_ptr));
+    pthread_mutex_init(&stats_ptr->mutex, NULL);
+    stats_ptr->random_state = 0x9e3779b97f4a7c15ull;
+    stats_ptr->latency_array = malloc(MAX_LATENCY_SAMPLES * sizeof(uint64_t));
+    if (stats_ptr->latency_array == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static uint64_t NextRandom(uint64_t* state_ptr)
+{
+    // xorshift64*
+    uint64_t x = *state_ptr;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state_ptr = x;
+    return x * 0x2545f4914f6cdd1dull;
+}
+
+/// @brief Record a latency measurement. Once MAX_LATENCY_SAMPLES are stored, reservoir sampling keeps a uniform random
+/// sample of all measurements, so percentiles describe the whole run and not only its start.
+static void DirectionStatsAddLatency(DirectionStats* stats_ptr, uint64_t latency_nanosecs)
+{
+    stats_ptr->latency_measured_count++;
+    if (latency_nanosecs > stats_ptr->latency_maximum) {
+        stats_ptr->latency_maximum = latency_nanosecs;
+    }
+    if (stats_ptr->latency_count < MAX_LATENCY_SAMPLES) {
+        stats_ptr->latency_array[stats_ptr->latency_count++] = latency_nanosecs;
+        return;
+    }
+    uint64_t index = NextRandom(&stats_ptr->random_state) % stats_ptr->latency_measured_count;
+    if (index < MAX_LATENCY_SAMPLES) {
+        stats_ptr->latency_array[index] = latency_nanosecs;
+    }
+}
+
+static int CompareUint64(const void* a_ptr, const void* b_ptr)
+{
+    uint64_t a = *(const uint64_t*)a_ptr;
+    uint64_t b = *(const uint64_t*)b_ptr;
+    return (a > b) - (a < b);
+}
+
+/// @brief Return the given percentile of sorted latency samples in microseconds.
+static double Percentile(const DirectionStats* stats_ptr, double percentile)
+{
+    if (stats_ptr->latency_count == 0) {
+        return 0.0;
+    }
+    if (percentile >= 100.0) {
+        return (double)stats_ptr->latency_maximum / 1000.0;
+    }
+    uint64_t index = (uint64_t)((percentile / 100.0) * (double)(stats_ptr->latency_count - 1) + 0.5);
+    return (double)stats_ptr->latency_array[index] / 1000.0;
+}
+
+static int PayloadSizeBytes(const BenchmarkOptions* options_ptr)
+{
+    int size = 0;
+    for (int i = 0; i < options_ptr->flow_count; i++) {
+        size += options_ptr->flow_array[i]->size_in_bytes;
+    }
+    return size;
+}
+
+static int IsAncFlow(const FlowPreset* flow_ptr)
+{
+    return strcmp(flow_ptr->name_str, "anc") == 0;
+}
+
+/// @brief Return the number of media element bytes sent per payload. Ancillary data elements only hold a header with
+/// an ANC_Count of zero, so this is smaller than PayloadSizeBytes() when an anc flow is used.
+static int PayloadDataBytes(const BenchmarkOptions* options_ptr)
+{
+    int size = 0;
+    for (int i = 0; i < options_ptr->flow_count; i++) {
+        size += IsAncFlow(options_ptr->flow_array[i]) ? GCCG_ANC_HEADER_SIZE_BYTES
+                                                      : options_ptr->flow_array[i]->size_in_bytes;
+    }
+    return size;
+}
+
+static char* BuildConnectionJson(const BenchmarkOptions* options_ptr, const char* transport_json_str)
+{
+    size_t size = strlen(transport_json_str) + 512;
+    for (int i = 0; i < options_ptr->flow_count; i++) {
+        size += strlen(options_ptr->flow_array[i]->media_element_json_str) + 1;
+    }
+    char* json_str = malloc(size);
+    if (json_str == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    int offset = snprintf(json_str, size,
+                          "{\"gccgVersion\":\"01.00\",\"timing\":{\"GMID\":\"00-00-00-00-00-00-00-00\","
+                          "\"tMinAccumulated\":0,\"t99Accumulated\":0},\"level\":[\"Level 3 UHD\"],"
+                          "\"transportParameters\":%s,\"mediaFlow\":{\"mediaElement\":[", transport_json_str);
+    for (int i = 0; i < options_ptr->flow_count; i++) {
+        offset += snprintf(json_str + offset, size - (size_t)offset, "%s%s", i ? "," : "",
+                           options_ptr->flow_array[i]->media_element_json_str);
+    }
+    snprintf(json_str + offset, size - (size_t)offset, "]}}");
+    return json_str;
+}
+
+static void CountCompletion(DirectionStats* stats_ptr, GccgReturnStatus status_code)
+{
+    if (status_code == kGccgStatusTimeoutExpired) {
+        stats_ptr->timeouts++;
+    } else if (status_code != kGccgStatusOk) {
+        stats_ptr->errors++;
+    }
+}
+
+static void TxCallback(const GccgTxCbData* data_ptr)
+{
+    int slot = (int)(intptr_t)data_ptr->user_cb_param_ptr;
+    uint64_t now = ClockMonotonicNanosecs();
+
+    pthread_mutex_lock(&g_tx_stats.mutex);
+    CountCompletion(&g_tx_stats, data_ptr->status_code);
+    if (data_ptr->status_code == kGccgStatusOk) {
+        g_tx_stats.payloads++;
+        g_tx_stats.bytes += (uint64_t)g_tx.payload_data_bytes;
+        DirectionStatsAddLatency(&g_tx_stats, now - g_tx.submit_time_array[slot]);
+    }
+    pthread_mutex_unlock(&g_tx_stats.mutex);
+
+    pthread_mutex_lock(&g_tx.mutex);
+    g_tx.free_array[g_tx.free_count++] = slot;
+    pthread_mutex_unlock(&g_tx.mutex);
+}
+
+static void RxCallback(const GccgRxCbData* data_ptr)
+{
+    uint64_t now = ClockSdkNanosecs();
+
+    pthread_mutex_lock(&g_rx_stats.mutex);
+    CountCompletion(&g_rx_stats, data_ptr->status_code);
+    if (data_ptr->status_code == kGccgStatusOk && data_ptr->media_array != NULL) {
+        uint64_t bytes = 0;
+        const GccgMediaElement* first_ptr = NULL;
+        if (data_ptr->payload_info_ptr != NULL) {
+            now = (uint64_t)data_ptr->payload_info_ptr->lat.seconds * 1000000000ull +
+                  data_ptr->payload_info_ptr->lat.nanoseconds;
+        }
+        for (int i = 0; i < data_ptr->media_array->count; i++) {
+            const GccgMediaElement* element_ptr = data_ptr->media_array->media_array[i];
+            if (element_ptr != NULL) {
+                bytes += (uint64_t)element_ptr->size_in_bytes;
+                if (first_ptr == NULL) {
+                    first_ptr = element_ptr;
+                }
+            }
+        }
+        g_rx_stats.payloads++;
+        g_rx_stats.bytes += bytes;
+        if (first_ptr != NULL) {
+            uint64_t cot = (uint64_t)first_ptr->origination_timestamp.seconds * 1000000000ull +
+                           first_ptr->origination_timestamp.nanoseconds;
+            if (now >= cot) {
+                DirectionStatsAddLatency(&g_rx_stats, now - cot);
+            }
+        }
+    }
+    pthread_mutex_unlock(&g_rx_stats.mutex);
+
+    if (data_ptr->media_array != NULL) {
+        GccgRxFreeBuffer((GccgMediaElements*)data_ptr->media_array);
+    }
+}
+
+static void TxStateInit(const BenchmarkOptions* options_ptr, char* buffer_ptr)
+{
+    int count = options_ptr->inflight_count;
+    g_tx.buffer_ptr = buffer_ptr;
+    g_tx.payload_size_bytes = PayloadSizeBytes(options_ptr);
+    pthread_mutex_init(&g_tx.mutex, NULL);
+    g_tx.free_count = count;
+    g_tx.free_array = malloc((size_t)count * sizeof(int));
+    g_tx.submit_time_array = calloc((size_t)count, sizeof(uint64_t));
+    g_tx.element_array = calloc((size_t)count * (size_t)options_ptr->flow_count, sizeof(GccgMediaElement));
+    g_tx.element_ptr_array = calloc((size_t)count * (size_t)options_ptr->flow_count, sizeof(GccgMediaElement*));
+    if (g_tx.free_array == NULL || g_tx.submit_time_array == NULL || g_tx.element_array == NULL ||
+        g_tx.element_ptr_array == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Each slot holds one payload with its media elements laid out one after the other.
+    for (int slot = 0; slot < count; slot++) {
+        char* address_ptr = buffer_ptr + (size_t)slot * (size_t)g_tx.payload_size_bytes;
+        g_tx.free_array[slot] = count - 1 - slot;
+        for (int i = 0; i < options_ptr->flow_count; i++) {
+            int index = slot * options_ptr->flow_count + i;
+            g_tx.element_array[index].size_in_bytes = options_ptr->flow_array[i]->size_in_bytes;
+            g_tx.element_array[index].address_ptr = address_ptr;
+            g_tx.element_ptr_array[index] = &g_tx.element_array[index];
+            address_ptr += options_ptr->flow_array[i]->size_in_bytes;
+        }
+    }
+    memset(buffer_ptr, 0x5a, (size_t)count * (size_t)g_tx.payload_size_bytes);
+
+    // Ancillary data elements must hold valid RFC 8331 data, so write a header with an ANC_Count of zero.
+    g_tx.payload_data_bytes = PayloadDataBytes(options_ptr);
+    for (int slot = 0; slot < count; slot++) {
+        for (int i = 0; i < options_ptr->flow_count; i++) {
+            if (IsAncFlow(options_ptr->flow_array[i])) {
+                GccgMediaElement* element_ptr = &g_tx.element_array[slot * options_ptr->flow_count + i];
+                GccgAncBuilder builder;
+                GccgAncBuilderInit(&builder, element_ptr->address_ptr, element_ptr->size_in_bytes,
+                                   kGccgAncFieldProgressive);
+                GccgAncBuilderFinish(&builder, &element_ptr->size_in_bytes);
+            }
+        }
+    }
+}
+
+static int TxAcquireSlot(void)
+{
+    int slot = -1;
+    pthread_mutex_lock(&g_tx.mutex);
+    if (g_tx.free_count > 0) {
+        slot = g_tx.free_array[--g_tx.free_count];
+    }
+    pthread_mutex_unlock(&g_tx.mutex);
+    return slot;
+}
+
+static int TxAllSlotsFree(const BenchmarkOptions* options_ptr)
+{
+    pthread_mutex_lock(&g_tx.mutex);
+    int all_free = (g_tx.free_count == options_ptr->inflight_count);
+    pthread_mutex_unlock(&g_tx.mutex);
+    return all_free;
+}
+
+static void TxSubmit(const BenchmarkOptions* options_ptr, int slot)
+{
+    uint64_t cot = ClockSdkNanosecs();
+    GccgMediaElements media_array;
+    media_array.count = options_ptr->flow_count;
+    media_array.media_array = &g_tx.element_ptr_array[slot * options_ptr->flow_count];
+    for (int i = 0; i < options_ptr->flow_count; i++) {
+        media_array.media_array[i]->origination_timestamp.seconds = (uint32_t)(cot / 1000000000ull);
+        media_array.media_array[i]->origination_timestamp.nanoseconds = (uint32_t)(cot % 1000000000ull);
+    }
+
+    char payload_json_str[256];
+    snprintf(payload_json_str, sizeof(payload_json_str),
+             "{\"gccgVersion\":\"01.00\",\"timing\":{\"COT\":\"%llu\",\"tMinAccumulated\":0,\"t99Accumulated\":0},"
+             "\"mediaFlow\":{}}",
+             (unsigned long long)((cot / 1000000000ull) << 32 | (cot % 1000000000ull)));
+
+    g_tx.submit_time_array[slot] = ClockMonotonicNanosecs();
+    GccgReturnStatus status = GccgTxPayload(g_tx.handle, payload_json_str, media_array, (void*)(intptr_t)slot,
+                                            options_ptr->timeout_microsecs);
+    if (status != kGccgStatusOk) {
+        pthread_mutex_lock(&g_tx_stats.mutex);
+        g_tx_stats.errors++;
+        pthread_mutex_unlock(&g_tx_stats.mutex);
+        pthread_mutex_lock(&g_tx.mutex);
+        g_tx.free_array[g_tx.free_count++] = slot;
+        pthread_mutex_unlock(&g_tx.mutex);
+    }
+}
+
+static void ServiceEventLoop(const BenchmarkOptions* options_ptr, GccgConnectionHandle tx_handle,
+                             GccgConnectionHandle rx_handle)
+{
+    if (!options_ptr->event_loop) {
+        return;
+    }
+    if (tx_handle != NULL) {
+        GccgEventLoopPoll(tx_handle);
+    }
+    if (rx_handle != NULL) {
+        GccgEventLoopPoll(rx_handle);
+    }
+}
+
+static void PrintUsage(const char* program_str)
+{
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  --mode loopback|tx|rx     Benchmark mode (default loopback).\n"
+            "  --flow 1080p|uhd|pcm16|anc\n"
+            "                            Add a media element to the flow. May be repeated (default uhd).\n"
+            "  --tx-transport FILE       File holding the transportParameters json object of the transmitter.\n"
+            "  --rx-transport FILE       File holding the transportParameters json object of the receiver.\n"
+            "  --threads N               maximum_thread_count passed to GccgInitialize() (default -1).\n"
+            "  --event-loop              Use a single thread and GccgEventLoopPoll() (same as --threads 0).\n"
+            "  --duration SECONDS        Length of the measurement (default 10).\n"
+            "  --rate HZ                 Payloads per second to transmit. Zero transmits as fast as possible (default 0).\n"
+            "  --inflight N              Maximum number of payloads in flight (default 4).\n"
+            "  --timeout MICROSECS       timeout_microsecs passed to GccgTxPayload() (default 1000000).\n"
+            "  --json                    Write results in json format.\n",
+            program_str);
+}
+
+static const FlowPreset* FindFlowPreset(const char* name_str)
+{
+    for (size_t i = 0; i < sizeof(kFlowPresets) / sizeof(kFlowPresets[0]); i++) {
+        if (strcmp(kFlowPresets[i].name_str, name_str) == 0) {
+            return &kFlowPresets[i];
+        }
+    }
+    return NULL;
+}
+
+static void ParseOptions(int argc, char** argv, BenchmarkOptions* options_ptr)
+{
+    memset(options_ptr, 0, sizeof(*options_ptr));
+    options_ptr->mode_str = "loopback";
+    options_ptr->tx_transport_json_str = "{}";
+    options_ptr->rx_transport_json_str = "{}";
+    options_ptr->thread_count = -1;
+    options_ptr->duration_secs = 10.0;
+    options_ptr->inflight_count = 4;
+    options_ptr->timeout_microsecs = 1000000;
+
+    for (int i = 1; i < argc; i++) {
+        const char* value_str = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "--event-loop") == 0) {
+            options_ptr->event_loop = 1;
+            continue;
+        }
+        if (strcmp(argv[i], "--json") == 0) {
+            options_ptr->json_output = 1;
+            continue;
+        }
+        if (value_str == NULL) {
+            PrintUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+        i++;
+        if (strcmp(argv[i - 1], "--mode") == 0) {
+            options_ptr->mode_str = value_str;
+        } else if (strcmp(argv[i - 1], "--flow") == 0) {
+            const FlowPreset* preset_ptr = FindFlowPreset(value_str);
+            if (preset_ptr == NULL || options_ptr->flow_count == MAX_FLOW_COUNT) {
+                PrintUsage(argv[0]);
+                exit(EXIT_FAILURE);
+            }
+            options_ptr->flow_array[options_ptr->flow_count++] = preset_ptr;
+        } else if (strcmp(argv[i - 1], "--tx-transport") == 0) {
+            options_ptr->tx_transport_json_str = ReadFile(value_str);
+        } else if (strcmp(argv[i - 1], "--rx-transport") == 0) {
+            options_ptr->rx_transport_json_str = ReadFile(value_str);
+        } else if (strcmp(argv[i - 1], "--threads") == 0) {
+            options_ptr->thread_count = atoi(value_str);
+        } else if (strcmp(argv[i - 1], "--duration") == 0) {
+            options_ptr->duration_secs = atof(value_str);
+        } else if (strcmp(argv[i - 1], "--rate") == 0) {
+            options_ptr->rate_hz = atof(value_str);
+        } else if (strcmp(argv[i - 1], "--inflight") == 0) {
+            options_ptr->inflight_count = atoi(value_str);
+        } else if (strcmp(argv[i - 1], "--timeout") == 0) {
+            options_ptr->timeout_microsecs = atoi(value_str);
+        } else {
+            PrintUsage(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (options_ptr->flow_count == 0) {
+        options_ptr->flow_array[options_ptr->flow_count++] = FindFlowPreset("uhd");
+    }
+    if (options_ptr->event_loop) {
+        options_ptr->thread_count = 0;
+    } else if (options_ptr->thread_count == 0) {
+        options_ptr->event_loop = 1;
+    }
+    if (strcmp(options_ptr->mode_str, "loopback") != 0 && strcmp(options_ptr->mode_str, "tx") != 0 &&
+        strcmp(options_ptr->mode_str, "rx") != 0) {
+        PrintUsage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    if (options_ptr->inflight_count < 1 || options_ptr->duration_secs <= 0.0) {
+        PrintUsage(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void PrintDirection(const BenchmarkOptions* options_ptr, const char* name_str, DirectionStats* stats_ptr,
+                           double elapsed_secs, int last)
+{
+    qsort(stats_ptr->latency_array, stats_ptr->latency_count, sizeof(uint64_t), CompareUint64);
+    double payloads_per_sec = (double)stats_ptr->payloads / elapsed_secs;
+    double gbps = (double)stats_ptr->bytes * 8.0 / elapsed_secs / 1e9;
+
+    if (options_ptr->json_output) {
+        printf("  \"%s\": {\"payloads\": %llu, \"bytes\": %llu, \"timeouts\": %llu, \"errors\": %llu, "
+               "\"payloads_per_sec\": %.2f, \"gbps\": %.3f, \"latency_us\": {\"p50\": %.1f, \"p99\": %.1f, "
+               "\"p99_9\": %.1f, \"max\": %.1f, \"samples\": %llu, \"measurements\": %llu}}%s\n",
+               name_str, (unsigned long long)stats_ptr->payloads, (unsigned long long)stats_ptr->bytes,
+               (unsigned long long)stats_ptr->timeouts, (unsigned long long)stats_ptr->errors, payloads_per_sec, gbps,
+               Percentile(stats_ptr, 50.0), Percentile(stats_ptr, 99.0), Percentile(stats_ptr, 99.9),
+               Percentile(stats_ptr, 100.0), (unsigned long long)stats_ptr->latency_count,
+               (unsigned long long)stats_ptr->latency_measured_count, last ? "" : ",");
+    } else {
+        printf("%s: %llu payloads, %.2f payloads/s, %.3f Gb/s, %llu timeouts, %llu errors\n", name_str,
+               (unsigned long long)stats_ptr->payloads, payloads_per_sec, gbps,
+               (unsigned long long)stats_ptr->timeouts, (unsigned long long)stats_ptr->errors);
+        printf("%s latency (us): p50 %.1f, p99 %.1f, p99.9 %.1f, max %.1f", name_str, Percentile(stats_ptr, 50.0),
+               Percentile(stats_ptr, 99.0), Percentile(stats_ptr, 99.9), Percentile(stats_ptr, 100.0));
+        if (stats_ptr->latency_measured_count > stats_ptr->latency_count) {
+            printf(" (sampled %llu of %llu)", (unsigned long long)stats_ptr->latency_count,
+                   (unsigned long long)stats_ptr->latency_measured_count);
+        }
+        printf("\n");
+    }
+}
+
+static void PrintResults(const BenchmarkOptions* options_ptr, int use_tx, int use_rx, double elapsed_secs,
+                         double cpu_secs)
+{
+    // CPU usage is normalized to the bandwidth of the receiver when present, since that is what reached the far end.
+    const DirectionStats* bandwidth_ptr = use_rx ? &g_rx_stats : &g_tx_stats;
+    double gbps = (double)bandwidth_ptr->bytes * 8.0 / elapsed_secs / 1e9;
+    double cores = cpu_secs / elapsed_secs;
+    double cores_per_gbps = (gbps > 0.0) ? cores / gbps : 0.0;
+
+    if (options_ptr->json_output) {
+        printf("{\n  \"mode\": \"%s\",\n  \"threads\": %d,\n  \"event_loop\": %s,\n  \"flows\": [",
+               options_ptr->mode_str, options_ptr->thread_count, options_ptr->event_loop ? "true" : "false");
+        for (int i = 0; i < options_ptr->flow_count; i++) {
+            printf("%s\"%s\"", i ? ", " : "", options_ptr->flow_array[i]->name_str);
+        }
+        printf("],\n  \"payload_bytes\": %d,\n  \"duration_secs\": %.3f,\n  \"cpu\": {\"cpu_secs\": %.3f, "
+               "\"cores\": %.3f, \"cores_per_gbps\": %.4f},\n",
+               PayloadDataBytes(options_ptr), elapsed_secs, cpu_secs, cores, cores_per_gbps);
+        if (use_tx) {
+            PrintDirection(options_ptr, "tx", &g_tx_stats, elapsed_secs, !use_rx);
+        }
+        if (use_rx) {
+            PrintDirection(options_ptr, "rx", &g_rx_stats, elapsed_secs, 1);
+        }
+        printf("}\n");
+    } else {
+        printf("mode %s, threads %d%s, payload %d bytes, duration %.3f s\n", options_ptr->mode_str,
+               options_ptr->thread_count, options_ptr->event_loop ? " (event loop)" : "",
+               PayloadDataBytes(options_ptr), elapsed_secs);
+        if (use_tx) {
+            PrintDirection(options_ptr, "tx", &g_tx_stats, elapsed_secs, !use_rx);
+        }
+        if (use_rx) {
+            PrintDirection(options_ptr, "rx", &g_rx_stats, elapsed_secs, 1);
+        }
+        printf("cpu: %.3f s, %.3f cores, %.4f cores per Gb/s\n", cpu_secs, cores, cores_per_gbps);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    ParseOptions(argc, argv, &options);
+    int use_tx = strcmp(options.mode_str, "rx") != 0;
+    int use_rx = strcmp(options.mode_str, "tx") != 0;
+
+    DirectionStatsInit(&g_tx_stats);
+    DirectionStatsInit(&g_rx_stats);
+
+    GccgReturnStatus status = GccgInitialize(options.thread_count, -1);
+    if (status != kGccgStatusOk) {
+        fprintf(stderr, "GccgInitialize() failed with status %d\n", (int)status);
+        return EXIT_FAILURE;
+    }
+
+    static char ret_json_str[JSON_BUFFER_SIZE];
+    uint64_t payload_size_bytes = (uint64_t)PayloadSizeBytes(&options);
+    GccgConnectionHandle rx_handle = NULL;
+    GccgConnectionHandle tx_handle = NULL;
+
+    // The receiver is created first, so it is ready before the transmitter connects to it.
+    if (use_rx) {
+        char* connection_json_str = BuildConnectionJson(&options, options.rx_transport_json_str);
+        status = GccgRxConnectionCreate(connection_json_str, payload_size_bytes * (uint64_t)options.inflight_count * 2,
+                                        RxCallback, NULL, sizeof(ret_json_str), ret_json_str, &rx_handle);
+        free(connection_json_str);
+        if (status != kGccgStatusOk) {
+            fprintf(stderr, "GccgRxConnectionCreate() failed with status %d\n", (int)status);
+            return EXIT_FAILURE;
+        }
+    }
+    if (use_tx) {
+        char* connection_json_str = BuildConnectionJson(&options, options.tx_transport_json_str);
+        char* tx_buffer_ptr = NULL;
+        status = GccgTxConnectionCreate(connection_json_str, payload_size_bytes * (uint64_t)options.inflight_count,
+                                        TxCallback, sizeof(ret_json_str), ret_json_str, &tx_buffer_ptr, &tx_handle);
+        free(connection_json_str);
+        if (status != kGccgStatusOk) {
+            fprintf(stderr, "GccgTxConnectionCreate() failed with status %d\n", (int)status);
+            return EXIT_FAILURE;
+        }
+        g_tx.handle = tx_handle;
+        TxStateInit(&options, tx_buffer_ptr);
+    }
+
+    double cpu_start_secs = CpuSeconds();
+    uint64_t start = ClockMonotonicNanosecs();
+    uint64_t end = start + (uint64_t)(options.duration_secs * 1e9);
+    uint64_t period = (options.rate_hz > 0.0) ? (uint64_t)(1e9 / options.rate_hz) : 0;
+    uint64_t next_submit = start;
+
+    for (uint64_t now = start; now < end; now = ClockMonotonicNanosecs()) {
+        ServiceEventLoop(&options, tx_handle, rx_handle);
+        if (!use_tx) {
+            if (!options.event_loop) {
+                SleepNanosecs(1000000);
+            }
+            continue;
+        }
+        if (period != 0 && now < next_submit) {
+            if (!options.event_loop) {
+                SleepNanosecs(next_submit - now);
+            }
+            continue;
+        }
+        int slot = TxAcquireSlot();
+        if (slot < 0) {
+            if (!options.event_loop) {
+                SleepNanosecs(10000);
+            }
+            continue;
+        }
+        TxSubmit(&options, slot);
+        next_submit += period;
+    }
+
+    // Wait for payloads still in flight so they are accounted for, bounded by the transmit timeout.
+    if (use_tx) {
+        uint64_t drain_end = ClockMonotonicNanosecs() + (uint64_t)options.timeout_microsecs * 1000ull * 2;
+        while (!TxAllSlotsFree(&options) && ClockMonotonicNanosecs() < drain_end) {
+            ServiceEventLoop(&options, tx_handle, rx_handle);
+            if (!options.event_loop) {
+                SleepNanosecs(100000);
+            }
+        }
+    }
+    double elapsed_secs = (double)(ClockMonotonicNanosecs() - start) / 1e9;
+    double cpu_secs = CpuSeconds() - cpu_start_secs;
+
+    if (tx_handle != NULL) {
+        GccgConnectionDestroy(tx_handle);
+    }
+    if (rx_handle != NULL) {
+        GccgConnectionDestroy(rx_handle);
+    }
+
+    PrintResults(&options, use_tx, use_rx, elapsed_secs, cpu_secs);
+    return EXIT_SUCCESS;
+}
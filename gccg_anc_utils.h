@@ -0,0 +1,448 @@
+// -------------------------------------------------------------------------------------------
+// Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
+// This file is part of the VSF GCCG API, licensed under the BSD 2-Clause "Simplified" License.
+// License details at: https://github.com/vsf-tv/gccg-api/blob/mainline/LICENSE
+// -------------------------------------------------------------------------------------------
+
+#ifndef GCCG_ANC_UTILS_H__
+#define GCCG_ANC_UTILS_H__
+
+/**
+ * @file
+ * @brief
+ * This file defines header-only utility functions for parsing and building ancillary data media elements, which use the
+ * RFC 8331 packing model described in README.md. The functions work in place on the media element data and never
+ * allocate memory. A typical receive loop looks like:
+ *
+ *     GccgAncIterator iterator;
+ *     GccgAncPacket packet;
+ *     GccgAncIteratorInit(&iterator, element_ptr->address_ptr, element_ptr->size_in_bytes);
+ *     while (GccgAncIteratorNext(&iterator, &packet)) {
+ *         ...
+ *     }
+ *     if (iterator.status != kGccgStatusOk) {
+ *         ...
+ *     }
+ **/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "gccg_transport_api.h"
+
+/// Size in bytes of the header that precedes the ANC packets.
+#define GCCG_ANC_HEADER_SIZE_BYTES 4
+
+/// Maximum number of user data words of a single ANC packet.
+#define GCCG_ANC_MAX_DATA_COUNT 255
+
+/**
+ * @brief Values of the F field of the header, which identifies the field the ANC packets belong to.
+ */
+typedef enum {
+    kGccgAncFieldProgressive = 0, ///< Progressive video, or the field is not specified.
+    kGccgAncFieldFirst       = 2, ///< First field of interlaced video.
+    kGccgAncFieldSecond      = 3  ///< Second field of interlaced video.
+} GccgAncField;
+
+/**
+ * @brief Type used to define the location and identification fields of a single ANC packet.
+ */
+typedef struct {
+    /// @brief C flag. If non-zero, the ANC data corresponds to the color-difference channel.
+    int c_flag;
+
+    /// @brief Line_Number field (11 bits).
+    int line_number;
+
+    /// @brief Horizontal_Offset field (12 bits).
+    int horizontal_offset;
+
+    /// @brief S flag. If non-zero, stream_num is valid.
+    int s_flag;
+
+    /// @brief StreamNum field (7 bits).
+    int stream_num;
+
+    /// @brief Data Identifier (DID), without the parity bits.
+    uint8_t did;
+
+    /// @brief Secondary Data Identifier (SDID), or Data Block Number for type 1 packets, without the parity bits.
+    uint8_t sdid;
+} GccgAncPacketHeader;
+
+/**
+ * @brief Type used to return a single ANC packet by the GccgAncIteratorNext() function. The user data words are not
+ * decoded until one of the GccgAncPacketGet...() functions is called.
+ */
+typedef struct {
+    /// @brief Location and identification fields of the packet.
+    GccgAncPacketHeader header;
+
+    /// @brief Number of user data words of the packet.
+    int data_count;
+
+    /// @brief Start address of the packet within the media element data.
+    const uint8_t* packet_ptr;
+
+    /// @brief Size in bytes of the packet, including the checksum word and word alignment.
+    int packet_size_bytes;
+} GccgAncPacket;
+
+/**
+ * @brief Type used to define an entry of the filter set using the GccgAncIteratorSetFilter() function.
+ */
+typedef struct {
+    /// @brief DID to match.
+    uint8_t did;
+
+    /// @brief SDID to match, or -1 to match any SDID.
+    int sdid;
+} GccgAncFilterEntry;
+
+/**
+ * @brief Type used to iterate over the ANC packets of an ancillary data media element. All fields are private to the
+ * GccgAncIterator...() functions, except status.
+ */
+typedef struct {
+    const uint8_t* data_ptr;
+    int size_bytes;
+    int offset_bytes;
+    int anc_count;
+    int remaining_count;
+    GccgAncField field;
+    const GccgAncFilterEntry* filter_array;
+    int filter_count;
+    int filter_exclude;
+
+    /// @brief kGccgStatusOk, or kGccgStatusError if the data was found to be malformed. Iteration stops at the first
+    /// malformed packet.
+    GccgReturnStatus status;
+} GccgAncIterator;
+
+/**
+ * @brief Type used to build an ancillary data media element. All fields are private to the GccgAncBuilder...()
+ * functions, except status.
+ */
+typedef struct {
+    uint8_t* data_ptr;
+    int capacity_bytes;
+    int offset_bytes;
+    int anc_count;
+    GccgAncField field;
+
+    /// @brief kGccgStatusOk, or the status of the first GccgAncBuilderAddPacket() call that failed.
+    GccgReturnStatus status;
+} GccgAncBuilder;
+
+/// @brief Read a big-endian bit field of up to 25 bits that starts bit_offset bits from data_ptr.
+static inline uint32_t GccgAncReadBits(const uint8_t* data_ptr, uint32_t bit_offset, int bit_count)
+{
+    const uint8_t* byte_ptr = data_ptr + (bit_offset >> 3);
+    int shift = (int)(bit_offset & 7);
+    int byte_count = (shift + bit_count + 7) >> 3;
+    uint32_t value = 0;
+    for (int i = 0; i < byte_count; i++) {
+        value = (value << 8) | byte_ptr[i];
+    }
+    return (value >> (byte_count * 8 - shift - bit_count)) & ((1u << bit_count) - 1u);
+}
+
+/// @brief Write a big-endian bit field of up to 25 bits that starts bit_offset bits from data_ptr. The destination bits
+/// must be zero.
+static inline void GccgAncWriteBits(uint8_t* data_ptr, uint32_t bit_offset, int bit_count, uint32_t value)
+{
+    uint8_t* byte_ptr = data_ptr + (bit_offset >> 3);
+    int shift = (int)(bit_offset & 7);
+    int byte_count = (shift + bit_count + 7) >> 3;
+    uint32_t bits = (value & ((1u << bit_count) - 1u)) << (byte_count * 8 - shift - bit_count);
+    for (int i = byte_count - 1; i >= 0; i--) {
+        byte_ptr[i] |= (uint8_t)bits;
+        bits >>= 8;
+    }
+}
+
+/// @brief Add the even parity bit (b8) and its inverse (b9) to an 8-bit value, as used by the ANC 10-bit words.
+static inline uint16_t GccgAncAddParity(uint8_t value)
+{
+    uint8_t parity = value;
+    parity ^= (uint8_t)(parity >> 4);
+    parity ^= (uint8_t)(parity >> 2);
+    parity ^= (uint8_t)(parity >> 1);
+    parity &= 1u;
+    return (uint16_t)(value | (parity << 8) | ((parity ^ 1u) << 9));
+}
+
+/// @brief Size in bytes of an ANC packet with data_count user data words, including the word alignment.
+static inline int GccgAncPacketSizeBytes(int data_count)
+{
+    // First 32-bit word, then DID, SDID, Data_Count, the user data words and the checksum word, padded to 32 bits.
+    int bit_count = 32 + 10 * (3 + data_count + 1);
+    return ((bit_count + 31) / 32) * 4;
+}
+
+/**
+ * @brief Initialize an iterator over the ANC packets of an ancillary data media element.
+ *
+ * @param iterator_ptr Pointer to the iterator to initialize.
+ * @param data_ptr Start address of the media element data (address_ptr of the GccgMediaElement).
+ * @param size_bytes Size in bytes of the media element data (size_in_bytes of the GccgMediaElement).
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the data is too small to hold the header, then
+ *         kGccgStatusBufferToSmall will be returned and the iterator will not return any packet.
+ */
+static inline GccgReturnStatus GccgAncIteratorInit(GccgAncIterator* iterator_ptr, const void* data_ptr, int size_bytes)
+{
+    memset(iterator_ptr, 0, sizeof(*iterator_ptr));
+    iterator_ptr->data_ptr = (const uint8_t*)data_ptr;
+    iterator_ptr->size_bytes = size_bytes;
+    iterator_ptr->offset_bytes = GCCG_ANC_HEADER_SIZE_BYTES;
+    if (data_ptr == NULL || size_bytes < GCCG_ANC_HEADER_SIZE_BYTES) {
+        iterator_ptr->status = kGccgStatusBufferToSmall;
+        return iterator_ptr->status;
+    }
+    iterator_ptr->anc_count = (int)GccgAncReadBits(iterator_ptr->data_ptr, 0, 16);
+    iterator_ptr->field = (GccgAncField)GccgAncReadBits(iterator_ptr->data_ptr, 16, 2);
+    iterator_ptr->remaining_count = iterator_ptr->anc_count;
+    iterator_ptr->status = kGccgStatusOk;
+    return iterator_ptr->status;
+}
+
+/**
+ * @brief Restrict the packets returned by an iterator using their DID and SDID. Packets that are filtered out are
+ * skipped using only their Data_Count, without reading their user data words.
+ *
+ * @param iterator_ptr Pointer to an initialized iterator.
+ * @param filter_array Pointer to an array of filter entries. The array must remain valid while the iterator is used.
+ * @param filter_count Number of entries in filter_array. Use zero to remove the filter.
+ * @param exclude If zero, only packets matching an entry are returned. Otherwise packets matching an entry are skipped.
+ */
+static inline void GccgAncIteratorSetFilter(GccgAncIterator* iterator_ptr,
+                                            const GccgAncFilterEntry* filter_array,
+                                            int filter_count,
+                                            int exclude)
+{
+    iterator_ptr->filter_array = filter_array;
+    iterator_ptr->filter_count = filter_count;
+    iterator_ptr->filter_exclude = exclude != 0;
+}
+
+/**
+ * @brief Get the next ANC packet of an iterator.
+ *
+ * @param iterator_ptr Pointer to an initialized iterator.
+ * @param ret_packet_ptr Pointer where to write the packet.
+ *
+ * @return Non-zero if a packet was written to ret_packet_ptr. Zero if there are no more packets or the data is
+ *         malformed, in which case status of the iterator is set to kGccgStatusError.
+ */
+static inline int GccgAncIteratorNext(GccgAncIterator* iterator_ptr, GccgAncPacket* ret_packet_ptr)
+{
+    while (iterator_ptr->remaining_count > 0 && iterator_ptr->status == kGccgStatusOk) {
+        const uint8_t* packet_ptr = iterator_ptr->data_ptr + iterator_ptr->offset_bytes;
+        int available_bytes = iterator_ptr->size_bytes - iterator_ptr->offset_bytes;
+        if (available_bytes < GccgAncPacketSizeBytes(0)) {
+            iterator_ptr->status = kGccgStatusError;
+            break;
+        }
+        int data_count = (int)(GccgAncReadBits(packet_ptr, 52, 10) & 0xffu);
+        int packet_size_bytes = GccgAncPacketSizeBytes(data_count);
+        if (available_bytes < packet_size_bytes) {
+            iterator_ptr->status = kGccgStatusError;
+            break;
+        }
+        iterator_ptr->offset_bytes += packet_size_bytes;
+        iterator_ptr->remaining_count--;
+
+        uint8_t did = (uint8_t)GccgAncReadBits(packet_ptr, 32, 10);
+        uint8_t sdid = (uint8_t)GccgAncReadBits(packet_ptr, 42, 10);
+        if (iterator_ptr->filter_count > 0) {
+            int match = 0;
+            for (int i = 0; i < iterator_ptr->filter_count && !match; i++) {
+                match = iterator_ptr->filter_array[i].did == did &&
+                        (iterator_ptr->filter_array[i].sdid < 0 || iterator_ptr->filter_array[i].sdid == sdid);
+            }
+            if (match == iterator_ptr->filter_exclude) {
+                continue;
+            }
+        }
+
+        uint32_t first_word = GccgAncReadBits(packet_ptr, 0, 16) << 16 | GccgAncReadBits(packet_ptr, 16, 16);
+        ret_packet_ptr->header.c_flag = (int)(first_word >> 31);
+        ret_packet_ptr->header.line_number = (int)((first_word >> 20) & 0x7ffu);
+        ret_packet_ptr->header.horizontal_offset = (int)((first_word >> 8) & 0xfffu);
+        ret_packet_ptr->header.s_flag = (int)((first_word >> 7) & 1u);
+        ret_packet_ptr->header.stream_num = (int)(first_word & 0x7fu);
+        ret_packet_ptr->header.did = did;
+        ret_packet_ptr->header.sdid = sdid;
+        ret_packet_ptr->data_count = data_count;
+        ret_packet_ptr->packet_ptr = packet_ptr;
+        ret_packet_ptr->packet_size_bytes = packet_size_bytes;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Get the 10-bit user data words of a packet, including their parity bits.
+ *
+ * @param packet_ptr Pointer to a packet returned by GccgAncIteratorNext().
+ * @param ret_word_array Pointer to an array where to write the words. Must hold at least data_count values.
+ */
+static inline void GccgAncPacketGetUserDataWords(const GccgAncPacket* packet_ptr, uint16_t* ret_word_array)
+{
+    for (int i = 0; i < packet_ptr->data_count; i++) {
+        ret_word_array[i] = (uint16_t)GccgAncReadBits(packet_ptr->packet_ptr, (uint32_t)(62 + 10 * i), 10);
+    }
+}
+
+/**
+ * @brief Get the user data words of a packet as 8-bit values, without their parity bits.
+ *
+ * @param packet_ptr Pointer to a packet returned by GccgAncIteratorNext().
+ * @param ret_byte_array Pointer to an array where to write the values. Must hold at least data_count values.
+ */
+static inline void GccgAncPacketGetUserData(const GccgAncPacket* packet_ptr, uint8_t* ret_byte_array)
+{
+    for (int i = 0; i < packet_ptr->data_count; i++) {
+        ret_byte_array[i] = (uint8_t)GccgAncReadBits(packet_ptr->packet_ptr, (uint32_t)(62 + 10 * i), 10);
+    }
+}
+
+/**
+ * @brief Verify the Checksum_Word of a packet.
+ *
+ * @param packet_ptr Pointer to a packet returned by GccgAncIteratorNext().
+ *
+ * @return Non-zero if the checksum is valid.
+ */
+static inline int GccgAncPacketIsChecksumValid(const GccgAncPacket* packet_ptr)
+{
+    uint32_t sum = 0;
+    int word_count = 3 + packet_ptr->data_count;
+    for (int i = 0; i < word_count; i++) {
+        sum += GccgAncReadBits(packet_ptr->packet_ptr, (uint32_t)(32 + 10 * i), 10);
+    }
+    sum &= 0x1ffu;
+    sum |= ((~sum >> 8) & 1u) << 9;
+    return GccgAncReadBits(packet_ptr->packet_ptr, (uint32_t)(32 + 10 * word_count), 10) == sum;
+}
+
+/**
+ * @brief Initialize a builder that writes ANC packets into a buffer, for example a transmit buffer slot.
+ *
+ * @param builder_ptr Pointer to the builder to initialize.
+ * @param data_ptr Start address of the buffer.
+ * @param capacity_bytes Size in bytes of the buffer.
+ * @param field Value of the F field of the header.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the buffer is too small to hold the header, then
+ *         kGccgStatusBufferToSmall will be returned.
+ */
+static inline GccgReturnStatus GccgAncBuilderInit(GccgAncBuilder* builder_ptr,
+                                                  void* data_ptr,
+                                                  int capacity_bytes,
+                                                  GccgAncField field)
+{
+    memset(builder_ptr, 0, sizeof(*builder_ptr));
+    builder_ptr->data_ptr = (uint8_t*)data_ptr;
+    builder_ptr->capacity_bytes = capacity_bytes;
+    builder_ptr->offset_bytes = GCCG_ANC_HEADER_SIZE_BYTES;
+    builder_ptr->field = field;
+    builder_ptr->status = (data_ptr == NULL || capacity_bytes < GCCG_ANC_HEADER_SIZE_BYTES) ? kGccgStatusBufferToSmall
+                                                                                            : kGccgStatusOk;
+    return builder_ptr->status;
+}
+
+/**
+ * @brief Append an ANC packet to a builder. The parity bits of DID, SDID, Data_Count and the user data words, and the
+ * Checksum_Word, are computed by this function.
+ *
+ * @param builder_ptr Pointer to an initialized builder.
+ * @param header_ptr Pointer to the location and identification fields of the packet.
+ * @param user_data_array Pointer to the user data words as 8-bit values. May be NULL if data_count is zero.
+ * @param data_count Number of user data words. The maximum is GCCG_ANC_MAX_DATA_COUNT.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the packet does not fit in the buffer, then
+ *         kGccgStatusBufferToSmall will be returned and the packet is not added.
+ */
+static inline GccgReturnStatus GccgAncBuilderAddPacket(GccgAncBuilder* builder_ptr,
+                                                       const GccgAncPacketHeader* header_ptr,
+                                                       const uint8_t* user_data_array,
+                                                       int data_count)
+{
+    if (builder_ptr->status != kGccgStatusOk) {
+        return builder_ptr->status;
+    }
+    if (data_count < 0 || data_count > GCCG_ANC_MAX_DATA_COUNT || (data_count > 0 && user_data_array == NULL) ||
+        builder_ptr->anc_count == 0xffff) {
+        return kGccgStatusInvalidParameter;
+    }
+    int packet_size_bytes = GccgAncPacketSizeBytes(data_count);
+    if (builder_ptr->capacity_bytes - builder_ptr->offset_bytes < packet_size_bytes) {
+        builder_ptr->status = kGccgStatusBufferToSmall;
+        return builder_ptr->status;
+    }
+
+    uint8_t* packet_ptr = builder_ptr->data_ptr + builder_ptr->offset_bytes;
+    memset(packet_ptr, 0, (size_t)packet_size_bytes);
+    uint32_t first_word = ((uint32_t)(header_ptr->c_flag != 0) << 31) |
+                          (((uint32_t)header_ptr->line_number & 0x7ffu) << 20) |
+                          (((uint32_t)header_ptr->horizontal_offset & 0xfffu) << 8) |
+                          ((uint32_t)(header_ptr->s_flag != 0) << 7) |
+                          ((uint32_t)header_ptr->stream_num & 0x7fu);
+    GccgAncWriteBits(packet_ptr, 0, 16, first_word >> 16);
+    GccgAncWriteBits(packet_ptr, 16, 16, first_word & 0xffffu);
+
+    uint32_t bit_offset = 32;
+    uint32_t sum = 0;
+    uint16_t word = GccgAncAddParity(header_ptr->did);
+    GccgAncWriteBits(packet_ptr, bit_offset, 10, word);
+    sum += word;
+    bit_offset += 10;
+    word = GccgAncAddParity(header_ptr->sdid);
+    GccgAncWriteBits(packet_ptr, bit_offset, 10, word);
+    sum += word;
+    bit_offset += 10;
+    word = GccgAncAddParity((uint8_t)data_count);
+    GccgAncWriteBits(packet_ptr, bit_offset, 10, word);
+    sum += word;
+    bit_offset += 10;
+    for (int i = 0; i < data_count; i++) {
+        word = GccgAncAddParity(user_data_array[i]);
+        GccgAncWriteBits(packet_ptr, bit_offset, 10, word);
+        sum += word;
+        bit_offset += 10;
+    }
+    sum &= 0x1ffu;
+    sum |= ((~sum >> 8) & 1u) << 9;
+    GccgAncWriteBits(packet_ptr, bit_offset, 10, sum);
+
+    builder_ptr->offset_bytes += packet_size_bytes;
+    builder_ptr->anc_count++;
+    return kGccgStatusOk;
+}
+
+/**
+ * @brief Complete the data of a builder by writing the header. The returned size is used as size_in_bytes of the media
+ * element to transmit. A builder with no packets produces a header with an ANC_Count of zero, which must still be sent
+ * when there is no ANC data for a given period.
+ *
+ * @param builder_ptr Pointer to an initialized builder.
+ * @param ret_size_bytes_ptr Pointer where to write the total size in bytes of the data.
+ *
+ * @return The status of the builder.
+ */
+static inline GccgReturnStatus GccgAncBuilderFinish(GccgAncBuilder* builder_ptr, int* ret_size_bytes_ptr)
+{
+    if (builder_ptr->data_ptr == NULL || builder_ptr->capacity_bytes < GCCG_ANC_HEADER_SIZE_BYTES) {
+        return builder_ptr->status;
+    }
+    memset(builder_ptr->data_ptr, 0, GCCG_ANC_HEADER_SIZE_BYTES);
+    GccgAncWriteBits(builder_ptr->data_ptr, 0, 16, (uint32_t)builder_ptr->anc_count);
+    GccgAncWriteBits(builder_ptr->data_ptr, 16, 2, (uint32_t)builder_ptr->field);
+    *ret_size_bytes_ptr = builder_ptr->offset_bytes;
+    return builder_ptr->status;
+}
+
+#endif // GCCG_ANC_UTILS_H__
@@ -0,0 +1,325 @@
+// -------------------------------------------------------------------------------------------
+// Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
+// This file is part of the VSF GCCG API, licensed under the BSD 2-Clause "Simplified" License.
+// License details at: https://github.com/vsf-tv/gccg-api/blob/mainline/LICENSE
+// -------------------------------------------------------------------------------------------
+
+#ifndef GCCG_MEDIA_UTILS_H__
+#define GCCG_MEDIA_UTILS_H__
+
+/**
+ * @file
+ * @brief
+ * This file declares utility functions provided by the SDK for converting media data between the formats used by the
+ * GCCG transport API (see README.md) and the buffer layouts commonly used by applications. The functions are optimized
+ * for the CPU the application runs on, using SIMD instructions selected at runtime.
+ **/
+
+#include <stdint.h>
+
+#include "gccg_transport_api.h"
+
+/**
+ * @brief Bit values used to identify CPU instruction set extensions that the conversion functions can use.
+ */
+typedef enum {
+    kGccgCpuFeatureNone   = 0,
+    kGccgCpuFeatureSse41  = 0x00000001,
+    kGccgCpuFeatureAvx2   = 0x00000002,
+    kGccgCpuFeatureAvx512 = 0x00000004, ///< AVX-512 F, BW and VL.
+    kGccgCpuFeatureNeon   = 0x00000100
+} GccgCpuFeatureFlags;
+
+/**
+ * Get the CPU instruction set extensions that are supported by both the CPU and the SDK, and the subset currently used
+ * by the conversion functions. This API is thread-safe.
+ *
+ * @param ret_supported_features_ptr Pointer where to write a bitwise OR of GccgCpuFeatureFlags values supported.
+ * @param ret_enabled_features_ptr Pointer where to write a bitwise OR of GccgCpuFeatureFlags values in use.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgUtilsGetCpuFeatures(uint32_t* ret_supported_features_ptr,
+                                                        uint32_t* ret_enabled_features_ptr);
+
+/**
+ * Restrict the CPU instruction set extensions used by the conversion functions. By default all supported extensions are
+ * used. This is mainly intended for testing and for comparing the performance of the different implementations. It must
+ * not be called while a conversion function is running on another thread.
+ *
+ * @param enabled_features Bitwise OR of GccgCpuFeatureFlags values to use. Values that are not supported are ignored.
+ *                         Use kGccgCpuFeatureNone to only use portable code.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgUtilsSetCpuFeatures(uint32_t enabled_features);
+
+/**
+ * @brief Bit values used to modify the behavior of the conversion functions.
+ */
+typedef enum {
+    kGccgConvertFlagNone        = 0,
+    /// Write the destination using non-temporal (streaming) stores that bypass the CPU caches. Use when converting
+    /// directly into a transmit buffer slot, since the data is not read again by the CPU before it is transmitted.
+    kGccgConvertFlagNonTemporal = 0x00000001
+} GccgConvertFlags;
+
+/**
+ * @brief Values used to identify the video color sampling. These match the "sampling" values of videoAttributes in the
+ * connection schema.
+ */
+typedef enum {
+    kGccgVideoSamplingYCbCr420 = 0, ///< "YCbCr-4:2:0"
+    kGccgVideoSamplingYCbCr422 = 1, ///< "YCbCr-4:2:2"
+    kGccgVideoSamplingYCbCr444 = 2, ///< "YCbCr-4:4:4"
+    kGccgVideoSamplingRgb      = 3  ///< "RGB"
+} GccgVideoSampling;
+
+/**
+ * @brief Type used to define the format of raw video stored in ST2110-20 pgroup format.
+ */
+typedef struct {
+    /// @brief Video color sampling.
+    GccgVideoSampling sampling;
+
+    /// @brief Video pixel bit depth. One of 8, 10 or 12.
+    int depth;
+
+    /// @brief Video picture width in pixels.
+    int width;
+
+    /// @brief Video picture height in pixels. For interlaced video this is the height of the frame.
+    int height;
+
+    /// @brief If non-zero, the video is interlaced. The pgroup data then holds all lines of the first field followed by
+    /// all lines of the second field, while picture buffers hold the lines of both fields interleaved as a frame. Line
+    /// indexes passed to the conversion functions always refer to lines of the frame.
+    int interlace;
+} GccgVideoFormat;
+
+/**
+ * @brief Values used to identify the layout of a picture buffer used by the application.
+ */
+typedef enum {
+    /// One plane per component (Y, Cb, Cr or R, G, B), each sample stored as a native-endian 16-bit value with the
+    /// sample value in the least significant bits. Supports every sampling and depth.
+    kGccgPictureLayoutPlanar16 = 0,
+    /// A single plane of 4:2:2 10-bit samples packed three per 32-bit little-endian word, with rows padded to a multiple
+    /// of 48 pixels. Only supports kGccgVideoSamplingYCbCr422 with a depth of 10.
+    kGccgPictureLayoutV210     = 1,
+    /// A Y plane and an interleaved CbCr plane, each sample stored as a little-endian 16-bit value with the sample value
+    /// in the most significant bits. Only supports kGccgVideoSamplingYCbCr420 with a depth of 10.
+    kGccgPictureLayoutP010     = 2,
+    /// A Y plane and an interleaved CbCr plane with 8-bit samples. Only supports kGccgVideoSamplingYCbCr420 with a depth
+    /// of 8.
+    kGccgPictureLayoutNv12     = 3
+} GccgPictureLayout;
+
+/// Maximum number of planes of a GccgPictureBuffer.
+#define GCCG_PICTURE_MAX_PLANE_COUNT 3
+
+/**
+ * @brief Type used to define a picture buffer used by the application.
+ */
+typedef struct {
+    /// @brief Layout of the picture.
+    GccgPictureLayout layout;
+
+    /// @brief Start address of each plane. Planes that are not used by the layout are ignored.
+    void* plane_ptr_array[GCCG_PICTURE_MAX_PLANE_COUNT];
+
+    /// @brief Distance in bytes between the start of two consecutive rows of each plane.
+    int stride_bytes_array[GCCG_PICTURE_MAX_PLANE_COUNT];
+} GccgPictureBuffer;
+
+/**
+ * Get the number of bytes required to hold a complete picture of the given format in pgroup format. This API is
+ * thread-safe.
+ *
+ * @param format_ptr Pointer to the video format.
+ * @param ret_size_bytes_ptr Pointer where to write the size in bytes.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the format is not valid, then kGccgStatusInvalidParameter
+ *         will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgVideoGetPgroupSize(const GccgVideoFormat* format_ptr,
+                                                       uint64_t* ret_size_bytes_ptr);
+
+/**
+ * Convert a range of lines of a picture from pgroup format to the layout of a picture buffer. This API is thread-safe.
+ *
+ * @param format_ptr Pointer to the video format.
+ * @param pgroup_ptr Start address of the complete picture in pgroup format, for example address_ptr of a received media
+ *                   element.
+ * @param pgroup_size_bytes Size in bytes of the data at pgroup_ptr.
+ * @param first_line Index of the first line to convert. For 4:2:0 sampling it must be even.
+ * @param line_count Number of lines to convert. Use -1 to convert all lines from first_line to the end of the picture.
+ *                   For 4:2:0 sampling it must be even, unless the range ends at the end of the picture.
+ * @param picture_ptr Pointer to the destination picture buffer. The lines are written at the same line index in the
+ *                    picture buffer.
+ * @param flags Bitwise OR of GccgConvertFlags values.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the layout of picture_ptr does not support the format, then
+ *         kGccgStatusInvalidParameter will be returned. If pgroup_size_bytes is too small, then kGccgStatusBufferToSmall
+ *         will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgVideoPgroupUnpack(const GccgVideoFormat* format_ptr,
+                                                      const void* pgroup_ptr,
+                                                      uint64_t pgroup_size_bytes,
+                                                      int first_line,
+                                                      int line_count,
+                                                      const GccgPictureBuffer* picture_ptr,
+                                                      uint32_t flags);
+
+/**
+ * Convert a range of lines of a picture from the layout of a picture buffer to pgroup format. Use this function with the
+ * kGccgConvertFlagNonTemporal flag to convert directly into a transmit buffer slot, without an intermediate copy. This
+ * API is thread-safe.
+ *
+ * @param format_ptr Pointer to the video format.
+ * @param picture_ptr Pointer to the source picture buffer.
+ * @param first_line Index of the first line to convert. For 4:2:0 sampling it must be even.
+ * @param line_count Number of lines to convert. Use -1 to convert all lines from first_line to the end of the picture.
+ *                   For 4:2:0 sampling it must be even, unless the range ends at the end of the picture.
+ * @param pgroup_ptr Start address of the complete picture in pgroup format, for example address_ptr of a media element
+ *                   to transmit. The lines are written at the same line index in the pgroup data.
+ * @param pgroup_size_bytes Size in bytes of the buffer at pgroup_ptr.
+ * @param flags Bitwise OR of GccgConvertFlags values.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the layout of picture_ptr does not support the format, then
+ *         kGccgStatusInvalidParameter will be returned. If pgroup_size_bytes is too small, then kGccgStatusBufferToSmall
+ *         will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgVideoPgroupPack(const GccgVideoFormat* format_ptr,
+                                                    const GccgPictureBuffer* picture_ptr,
+                                                    int first_line,
+                                                    int line_count,
+                                                    void* pgroup_ptr,
+                                                    uint64_t pgroup_size_bytes,
+                                                    uint32_t flags);
+
+/**
+ * @brief Values used to identify the sample format of planar audio buffers used by the application. Samples are stored in
+ * native byte order.
+ *
+ * Each 32-bit PCM word is a signed two's complement value aligned to the most significant bit, so full scale is the
+ * same for every depth. For example a sample with a depth of 24 occupies the upper 24 bits, and the lower 8 bits are
+ * zero. The conversion of each format from and to the PCM word pcm is described with its value below. When converting
+ * to a narrower format, the low bits are truncated, without rounding or dithering.
+ */
+typedef enum {
+    /// 32-bit floating point samples, where full scale is the range -1.0 to 1.0. Converted from PCM as pcm / 2^31.
+    /// Converted to PCM as value * 2^31, truncated toward zero and clipped to the range -2^31 to 2^31 - 1.
+    kGccgAudioSampleFloat32 = 0,
+    /// 32-bit signed integer samples. The value is pcm unchanged.
+    kGccgAudioSampleInt32   = 1,
+    /// 24-bit signed integer samples, sign-extended into 32-bit values. Converted from PCM as pcm >> 8 (arithmetic
+    /// shift), and to PCM as value << 8.
+    kGccgAudioSampleInt24   = 2,
+    /// 16-bit signed integer samples. Converted from PCM as pcm >> 16 (arithmetic shift), and to PCM as value << 16.
+    kGccgAudioSampleInt16   = 3
+} GccgAudioSampleFormat;
+
+/**
+ * @brief Values used to identify the designation of an audio channel, as defined by the SMPTE ST2110-30 channel order
+ * symbols.
+ */
+typedef enum {
+    kGccgAudioChannelUndefined         = 0,  ///< "U", or any channel of an "SGRP" group.
+    kGccgAudioChannelMono              = 1,  ///< "M"
+    kGccgAudioChannelLeft              = 2,  ///< "L" of "DM", "ST" or a surround group.
+    kGccgAudioChannelRight             = 3,  ///< "R" of "DM", "ST" or a surround group.
+    kGccgAudioChannelLeftTotal         = 4,  ///< "Lt"
+    kGccgAudioChannelRightTotal        = 5,  ///< "Rt"
+    kGccgAudioChannelCenter            = 6,  ///< "C"
+    kGccgAudioChannelLfe               = 7,  ///< "LFE"
+    kGccgAudioChannelLeftSurround      = 8,  ///< "Ls"
+    kGccgAudioChannelRightSurround     = 9,  ///< "Rs"
+    kGccgAudioChannelLeftRearSurround  = 10, ///< "Lrs"
+    kGccgAudioChannelRightRearSurround = 11  ///< "Rrs"
+} GccgAudioChannel;
+
+/**
+ * Build a channel map for the PCM conversion functions from the channelOrder value of audioAttributes. For each wanted
+ * channel designation, the index of the first channel of the PCM data with that designation that is not already used by
+ * a previous entry is written to the map. Use repeated kGccgAudioChannelMono or kGccgAudioChannelUndefined entries to
+ * select successive channels of the same designation. This API is thread-safe.
+ *
+ * @param channel_order_str The channelOrder value, for example "SMPTE2110.(51)".
+ * @param total_channels The totalChannels value of audioAttributes.
+ * @param wanted_channel_array Pointer to an array of the channel designations wanted, in the order of the planar buffers.
+ * @param wanted_channel_count Number of values in wanted_channel_array.
+ * @param ret_channel_map_array Pointer to an array of wanted_channel_count values where to write the PCM channel index of
+ *                              each wanted channel. A value of -1 is written for channels that are not present.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If channel_order_str cannot be parsed, then
+ *         kGccgStatusInvalidParameter will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgAudioGetChannelMap(const char* channel_order_str,
+                                                       int total_channels,
+                                                       const GccgAudioChannel* wanted_channel_array,
+                                                       int wanted_channel_count,
+                                                       int* ret_channel_map_array);
+
+/**
+ * Convert interleaved 32-bit big-endian PCM audio to planar buffers, swapping bytes, converting the sample format and
+ * selecting channels in a single pass. This API is thread-safe.
+ *
+ * @param pcm_ptr Start address of the interleaved PCM data, for example address_ptr of a received media element.
+ * @param pcm_size_bytes Size in bytes of the data at pcm_ptr.
+ * @param total_channels Number of interleaved channels in the PCM data (totalChannels).
+ * @param sample_count Number of samples per channel to convert (sampleCount).
+ * @param channel_map_array Pointer to an array of channel_count values that holds, for each planar buffer, the index of
+ *                          the PCM channel to convert into it. A value of -1 fills the buffer with silence. If NULL, PCM
+ *                          channels 0 to channel_count - 1 are converted in order, which selects the first activeChannels
+ *                          channels when channel_count is set to activeChannels.
+ * @param channel_count Number of planar buffers.
+ * @param sample_format Sample format of the planar buffers.
+ * @param plane_ptr_array Pointer to an array of channel_count planar buffer start addresses. Each buffer must be large
+ *                        enough for sample_count samples.
+ * @param flags Bitwise OR of GccgConvertFlags values.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If pcm_size_bytes is smaller than 4 * total_channels *
+ *         sample_count, then kGccgStatusBufferToSmall will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgAudioPcmDeinterleave(const void* pcm_ptr,
+                                                         uint64_t pcm_size_bytes,
+                                                         int total_channels,
+                                                         int sample_count,
+                                                         const int* channel_map_array,
+                                                         int channel_count,
+                                                         GccgAudioSampleFormat sample_format,
+                                                         void* const* plane_ptr_array,
+                                                         uint32_t flags);
+
+/**
+ * Convert planar audio buffers to interleaved 32-bit big-endian PCM audio, converting the sample format, placing
+ * channels and swapping bytes in a single pass. This API is thread-safe.
+ *
+ * @param sample_format Sample format of the planar buffers.
+ * @param plane_ptr_array Pointer to an array of channel_count planar buffer start addresses.
+ * @param channel_count Number of planar buffers.
+ * @param channel_map_array Pointer to an array of channel_count values that holds, for each planar buffer, the index of
+ *                          the PCM channel to write it to. A value of -1 skips the buffer. PCM channels that no buffer is
+ *                          written to are filled with silence. If NULL, the buffers are written to PCM channels 0 to
+ *                          channel_count - 1 in order.
+ * @param total_channels Number of interleaved channels in the PCM data (totalChannels).
+ * @param sample_count Number of samples per channel to convert (sampleCount).
+ * @param pcm_ptr Start address of the interleaved PCM data, for example address_ptr of a media element to transmit.
+ * @param pcm_size_bytes Size in bytes of the buffer at pcm_ptr.
+ * @param flags Bitwise OR of GccgConvertFlags values.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If pcm_size_bytes is smaller than 4 * total_channels *
+ *         sample_count, then kGccgStatusBufferToSmall will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgAudioPcmInterleave(GccgAudioSampleFormat sample_format,
+                                                       const void* const* plane_ptr_array,
+                                                       int channel_count,
+                                                       const int* channel_map_array,
+                                                       int total_channels,
+                                                       int sample_count,
+                                                       void* pcm_ptr,
+                                                       uint64_t pcm_size_bytes,
+                                                       uint32_t flags);
+
+#endif // GCCG_MEDIA_UTILS_H__
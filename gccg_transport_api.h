@@ -33,7 +33,9 @@ typedef enum {
     kGccgStatusTimeoutExpired    = 1,
     kGccgStatusInvalidParameter  = 2,
     kGccgStatusBufferToSmall     = 3,
-    kGccgStatusError             = 4
+    kGccgStatusError             = 4,
+    kGccgStatusNotSupported      = 5,
+    kGccgStatusDeadlineMissed    = 6
 } GccgReturnStatus;
 
 /// @brief A structure for holding a timestamp defined in seconds and nanoseconds.
@@ -62,6 +64,8 @@ typedef struct {
     void* user_param_ptr;
 
     /// @brief Handle to internal data used within the SDK that relates to this payload. Do not use or modify this value.
+    /// The internal data is allocated from a per-connection arena when the connection is created, so no memory is
+    /// allocated when transmitting or receiving payloads.
     void* internal_data_ptr;
 } GccgMediaElement;
 
@@ -75,8 +79,10 @@ typedef struct {
     /// @brief Number of media elements in media_array.
     ///
     /// Note: This value must match the number of media elements configured when the connection was created using one
-    /// of the ...ConnectionCreate() API functions and cannot change. However, to allow for dynamic changes, pointers
+    /// of the ...ConnectionCreate() API functions and cannot change, including when the connection is reconfigured
+    /// using the GccgConnectionReconfigure() API function. However, to allow for dynamic changes, pointers
     /// in payload_array may be set to NULL to indicate one or more media elements are not present for a given payload.
+    /// When receiving, pointers of media elements deselected using the rx_element_mask option are also NULL.
     int count;
 
     GccgMediaElement** media_array; ///< Pointer to start of the array of media element pointers.
@@ -88,6 +94,75 @@ typedef struct {
  */
 typedef void* GccgConnectionHandle;
 
+/**
+ * @brief Bit values used in the changed_attributes_array of GccgPayloadInfo. Each value identifies a group of media
+ * element attributes from the payload schema that changed with a payload.
+ */
+typedef enum {
+    kGccgAttributeChangeNone              = 0,
+    /// Video sampling, depth, width, height, exactframerate, interlace or segmented changed.
+    kGccgAttributeChangeVideoFormat       = 0x00000001,
+    /// Video colorimetry, TCS, RANGE, PAR or alphaIncluded changed.
+    kGccgAttributeChangeVideoColor        = 0x00000002,
+    /// Video partialFrame changed.
+    kGccgAttributeChangeVideoPartialFrame = 0x00000004,
+    /// Audio activeChannels, channelOrder or language changed.
+    kGccgAttributeChangeAudioChannels     = 0x00000100,
+    /// Audio depth, originalDepth or sampleCount changed.
+    kGccgAttributeChangeAudioSamples      = 0x00000200,
+    /// Any of the ancillary data attributes changed.
+    kGccgAttributeChangeAncillaryData     = 0x00010000,
+    /// The connection was reconfigured using the GccgConnectionReconfigure() API function, and this is the first payload
+    /// that uses the new configuration. Combined with the flags of the attribute groups that changed.
+    kGccgAttributeChangeReconfigured      = 0x01000000
+} GccgAttributeChangeFlags;
+
+/**
+ * @brief Values used to identify the source of a timestamp or of the clock returned by GccgClockNow().
+ */
+typedef enum {
+    /// The system real-time clock, not disciplined by PTP.
+    kGccgClockSourceSystem   = 0,
+    /// A software clock disciplined by PTP to the grandmaster identified by the GMID of the connection.
+    kGccgClockSourcePtp      = 1,
+    /// The PTP hardware clock of the network interface. For a LAT, the timestamp was taken by the network interface
+    /// when the last packet of the payload was received.
+    kGccgClockSourceHardware = 2
+} GccgClockSource;
+
+/**
+ * @brief Type used to define the timing and attribute change information of a single payload in binary form. It holds
+ * the same timing data as the payload configuration json string (see payload_schema.json) and can be used in its place
+ * to avoid producing and parsing a json string for every payload.
+ */
+typedef struct {
+    /// @brief Content Origination Timestamp (COT) of the payload.
+    GccgTimestamp cot;
+
+    /// @brief Local Arrival Timestamp (LAT) of the payload. Set by the SDK when receiving and ignored when
+    /// transmitting. The SDK uses the hardware receive timestamp of the network interface when available, so the value
+    /// does not include scheduling delays of the receiving host. See lat_source.
+    GccgTimestamp lat;
+
+    /// @brief Accumulated minimum latency of the Workflow path up to this Workflow Step, in milliseconds.
+    int t_min_accumulated_ms;
+
+    /// @brief Accumulated maximum latency of the Workflow path up to this Workflow Step, in milliseconds.
+    int t99_accumulated_ms;
+
+    /// @brief Number of values in changed_attributes_array. Must match the number of media elements configured when the
+    /// connection was created, or be zero if no attributes changed.
+    int changed_attributes_count;
+
+    /// @brief Pointer to an array that holds one value per media element, in the same order as the media elements of the
+    /// connection. Each value is a bitwise OR of GccgAttributeChangeFlags values that identifies the attributes of that
+    /// media element that changed with this payload. May be NULL if changed_attributes_count is zero.
+    const uint32_t* changed_attributes_array;
+
+    /// @brief Source of the lat timestamp. Set by the SDK when receiving and ignored when transmitting.
+    GccgClockSource lat_source;
+} GccgPayloadInfo;
+
 /**
  * @brief A structure of this type is passed as the parameter to GccgTxCallback(). It contains data related to the
  * transmission of a single payload to a receiver and data related to the Tx connection.
@@ -102,13 +177,23 @@ typedef struct {
     /// @brief User defined callback parameter. This value is set as a parameter of the GccgTxPayload() API function. The
     /// value is not modified by the SDK.
     void* user_cb_param_ptr;
+
+    /// @brief Number of receivers the payload was transmitted to. This is one, unless the connection fans out to several
+    /// receivers.
+    int receiver_count;
+
+    /// @brief Number of receivers that acknowledged the payload. For a fan-out connection, status_code is kGccgStatusOk
+    /// only if receiver_ack_count equals receiver_count.
+    int receiver_ack_count;
 } GccgTxCbData;
 
 /**
  * @brief Prototype of transmit data callback function. The user code must implement a function with this prototype and
  * provide it to GccgTxConnectionCreate() as a parameter.
  *
- * This callback function is invoked when a complete payload has been transmitted.
+ * This callback function is invoked when a complete payload has been transmitted. With the shared-memory transport
+ * (urn:x-gccg:transport:shm) the receiver is handed the payload memory itself instead of a copy, so this callback
+ * function is invoked once the receiver has freed the payload using the GccgRxFreeBuffer() API function.
  *
  * Note: In a single threaded event loop driven configuration, the GccgEventLoopPoll() API function must be called in order
  * for this callback function to be invoked. In a multi-threaded configuration, this function may be invoked on a thread
@@ -132,7 +217,9 @@ typedef struct {
     GccgConnectionHandle connection_handle;
 
     /// @brief If no error occurred, a pointer to the payload configuration json string received with the payload.
-    /// Otherwise the value will be NULL.
+    /// Otherwise the value will be NULL. The value is also NULL if the connection was created with the
+    /// payload_json_disable option set. In that case the GccgRxGetPayloadJson() API function can be used to produce the
+    /// json string when it is needed.
     const char *payload_json_str;
 
     /// @brief If no error occurred, a pointer to an array of MediaElements that contain the received payload data.
@@ -142,6 +229,11 @@ typedef struct {
     /// @brief User defined callback parameter. This value is set as a parameter of the GccgRxConnectionCreate()
     /// API function. The value is not modified by the SDK.
     void* user_cb_param_ptr;
+
+    /// @brief If no error occurred, a pointer to the timing and attribute change information received with the payload.
+    /// Otherwise the value will be NULL. The data remains valid until the media elements are freed using the
+    /// GccgRxFreeBuffer() API function.
+    const GccgPayloadInfo* payload_info_ptr;
 } GccgRxCbData;
 
 /**
@@ -161,6 +253,50 @@ typedef struct {
  */
 typedef void (*GccgRxCallback)(const GccgRxCbData* data_ptr);
 
+/**
+ * @brief A structure of this type is passed as the parameter to GccgRxSliceCallback(). It reports that more lines of a
+ * raw video media element of a payload that is still being received are available.
+ */
+typedef struct {
+    /// @brief The handle of the instance which was created using a previous call to the GccgRxConnectionCreateEx() API
+    /// function.
+    GccgConnectionHandle connection_handle;
+
+    /// @brief Pointer to the timing and attribute change information of the payload.
+    const GccgPayloadInfo* payload_info_ptr;
+
+    /// @brief Pointer to the media elements of the payload. Only the lines reported as committed are valid. The same
+    /// pointer is later passed to the GccgRxCallback() callback API function once the complete payload has been
+    /// received, and must only be freed after that using the GccgRxFreeBuffer() API function.
+    const GccgMediaElements* media_array;
+
+    /// @brief Index in media_array of the video media element the lines belong to.
+    int element_index;
+
+    /// @brief Number of lines at the start of the media element that have been received. Lines are counted in the order
+    /// they are stored in the pgroup data, so for interlaced video all lines of the first field come first. In that case
+    /// the committed lines are not a contiguous range of frame lines, as used by the conversion functions of
+    /// gccg_media_utils.h.
+    int committed_line_count;
+
+    /// @brief Total number of lines of the media element.
+    int total_line_count;
+
+    /// @brief User defined callback parameter. This value is set as a parameter of the GccgRxConnectionCreateEx() API
+    /// function. The value is not modified by the SDK.
+    void* user_cb_param_ptr;
+} GccgRxSliceCbData;
+
+/**
+ * @brief Prototype of receive slice callback function. It is optional and is provided to the GccgRxConnectionCreateEx()
+ * API function using the rx_slice_cb_ptr option. It is invoked as lines of raw video media elements are received, before
+ * the complete payload is available. The same threading rules as for the GccgRxCallback() callback API function apply,
+ * and for a given payload all slice callbacks are invoked before its GccgRxCallback().
+ *
+ * @param data_ptr A pointer to a GccgRxSliceCbData structure.
+ */
+typedef void (*GccgRxSliceCallback)(const GccgRxSliceCbData* data_ptr);
+
 /**
  * @brief Initialize the GCCG transport API. This defines the number of threads and thread priority the underlying
  * implementation can use. It must be invoked once before using any other APIs.
@@ -175,6 +311,282 @@ typedef void (*GccgRxCallback)(const GccgRxCbData* data_ptr);
  */
 GCCG_INTERFACE GccgReturnStatus GccgInitialize(int maximum_thread_count, int maximum_thread_priority);
 
+/**
+ * @brief Values used to define the page size used for transmit and receive payload buffers allocated by the SDK.
+ */
+typedef enum {
+    /// Use 1 GB hugepages for payload buffers of at least 1 GB and 2 MB hugepages for smaller ones, falling back to
+    /// smaller pages if none are available. A small payload buffer therefore never occupies a whole 1 GB page.
+    kGccgPageSizeDefault  = 0,
+    /// Use regular pages.
+    kGccgPageSizeRegular  = 1,
+    /// Use 2 MB hugepages, falling back to regular pages if none are available.
+    kGccgPageSize2MB      = 2,
+    /// Use 1 GB hugepages, falling back to 2 MB hugepages and then regular pages if none are available. Each payload
+    /// buffer occupies at least one whole page, even if it is smaller.
+    kGccgPageSize1GB      = 3
+} GccgPageSize;
+
+/**
+ * @brief Type used to define an application provided allocator for the memory used by the SDK. All memory is allocated
+ * when connections are created, so the functions are never invoked from the data path. The functions may be invoked
+ * concurrently from several threads.
+ */
+typedef struct {
+    /// @brief Allocate a memory region of size_bytes aligned to alignment_bytes, preferably on the given NUMA node (-1 if
+    /// the SDK has no preference). Return NULL if the memory cannot be allocated. Large regions are used as payload
+    /// buffers; small ones hold internal per-connection data. Must not be NULL.
+    void* (*alloc_fn_ptr)(void* user_param_ptr, uint64_t size_bytes, uint64_t alignment_bytes, int numa_node);
+
+    /// @brief Free a memory region returned by alloc_fn_ptr. size_bytes is the size that was requested. Must not be
+    /// NULL.
+    void (*free_fn_ptr)(void* user_param_ptr, void* region_ptr, uint64_t size_bytes);
+
+    /// @brief Register a payload buffer region with the network interface for DMA. May be NULL, in which case the SDK
+    /// registers the region itself. Also used for application owned regions passed with the rx_buffer_ptr option.
+    GccgReturnStatus (*register_dma_fn_ptr)(void* user_param_ptr, void* region_ptr, uint64_t size_bytes);
+
+    /// @brief Undo a registration made by register_dma_fn_ptr. Must not be NULL if register_dma_fn_ptr is not NULL.
+    void (*unregister_dma_fn_ptr)(void* user_param_ptr, void* region_ptr, uint64_t size_bytes);
+
+    /// @brief User defined parameter passed to each function. The value is not modified by the SDK.
+    void* user_param_ptr;
+} GccgAllocator;
+
+/**
+ * @brief Type used to define the threading and memory placement settings passed to the GccgInitializeEx() API function.
+ */
+typedef struct {
+    /// @brief Maximum number of threads the underlying API can use. Same as the parameter of the same name of the
+    /// GccgInitialize() API function.
+    int maximum_thread_count;
+
+    /// @brief Maximum thread priority the underlying API can use. Same as the parameter of the same name of the
+    /// GccgInitialize() API function.
+    int maximum_thread_priority;
+
+    /// @brief Number of CPU indexes in io_cpu_array. Use zero to not restrict the CPUs used by I/O threads.
+    int io_cpu_count;
+
+    /// @brief Pointer to an array of CPU indexes (as numbered by the operating system) that the threads used for
+    /// transport I/O are pinned to.
+    const int* io_cpu_array;
+
+    /// @brief Number of CPU indexes in callback_cpu_array. Use zero to use the same CPUs as the I/O threads.
+    int callback_cpu_count;
+
+    /// @brief Pointer to an array of CPU indexes (as numbered by the operating system) that the threads used to invoke
+    /// the GccgTxCallback() and GccgRxCallback() callback API functions are pinned to.
+    const int* callback_cpu_array;
+
+    /// @brief NUMA node used to allocate the transmit and receive payload buffers and internal data of all connections.
+    /// This is normally the node the network interface is attached to. Use -1 to not restrict the implementation.
+    int numa_node;
+
+    /// @brief If not NULL, allocator used for the transmit and receive payload buffers and internal data of all
+    /// connections instead of the SDK allocator. The structure is copied by the SDK. In this case page_size is ignored.
+    const GccgAllocator* allocator_ptr;
+
+    /// @brief Page size of the payload buffers allocated by the SDK. See GccgPageSize. Using hugepages reduces TLB
+    /// misses when many large payload buffers are accessed.
+    GccgPageSize page_size;
+} GccgInitializeOptions;
+
+/**
+ * @brief Initialize the GCCG transport API using extended threading and memory placement settings. This is the same as
+ * the GccgInitialize() API function, but also allows the threads of the underlying implementation to be pinned to sets
+ * of CPUs and the payload buffers to be allocated from a specific NUMA node. It must be invoked once, instead of
+ * GccgInitialize(), before using any other APIs.
+ *
+ * @param options_ptr Pointer to the settings to use. The data is copied by the SDK before this function returns.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If a CPU index or the NUMA node does not exist, then
+ *         kGccgStatusInvalidParameter will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgInitializeEx(const GccgInitializeOptions* options_ptr);
+
+/**
+ * @brief Type used to return information about the clock used by the SDK by the GccgClockGetInfo() API function.
+ */
+typedef struct {
+    /// @brief Source of the clock returned by GccgClockNow().
+    GccgClockSource source;
+
+    /// @brief Non-zero if the clock is currently locked to its PTP grandmaster. Always zero for kGccgClockSourceSystem.
+    int locked;
+
+    /// @brief Most recent measured offset from the grandmaster, in nanoseconds. Zero if locked is zero.
+    int64_t offset_from_master_nanosecs;
+
+    /// @brief 64-bit grandmaster clock identifier in the same format as the GMID of the connection configuration data.
+    /// Empty if locked is zero.
+    char gmid_str[32];
+} GccgClockInfo;
+
+/**
+ * Get the current time of the clock used by the SDK for COT and LAT timestamps. The clock uses the SMPTE Epoch and is
+ * disciplined by PTP when available. It is read without a system call, so it is cheap enough to call for every payload,
+ * and never goes backwards. Applications should use it to set the COT of payloads they originate. This API is
+ * thread-safe and may be called before GccgInitialize().
+ *
+ * @param ret_timestamp_ptr Pointer where to write the current time.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgClockNow(GccgTimestamp* ret_timestamp_ptr);
+
+/**
+ * Get information about the clock returned by the GccgClockNow() API function. This API is thread-safe.
+ *
+ * @param ret_clock_info_ptr Pointer where to write the clock information.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgClockGetInfo(GccgClockInfo* ret_clock_info_ptr);
+
+/**
+ * Get the transport URN of one of the transports supported by the implementation and usable on this host. The URN is
+ * used as the "transport" value of transportParameters to select the transport of a connection. Call with index values
+ * starting at zero until kGccgStatusInvalidParameter is returned to enumerate all transports. This API is thread-safe.
+ *
+ * @param index Index of the transport.
+ * @param ret_urn_buffer_size Size of ret_urn_str buffer.
+ * @param ret_urn_str Pointer where to write the transport URN. If size of buffer is not large enough, then
+ *                    kGccgStatusBufferToSmall will be returned.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If index is not smaller than the number of transports, then
+ *         kGccgStatusInvalidParameter will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTransportGetUrn(int index, int ret_urn_buffer_size, char* ret_urn_str);
+
+/**
+ * @brief Type used as the handle (pointer to an opaque structure) for a completion queue. A completion queue is a
+ * lock-free ring that receives the Tx and Rx completions of one or more connections, as an alternative to the
+ * GccgTxCallback() and GccgRxCallback() callback API functions.
+ */
+typedef void* GccgCompletionQueueHandle;
+
+/**
+ * @brief Values used to identify the type of a GccgCompletionEvent.
+ */
+typedef enum {
+    kGccgCompletionEventTx = 0, ///< A payload was transmitted. tx_data is valid.
+    kGccgCompletionEventRx = 1  ///< A payload was received. rx_data is valid.
+} GccgCompletionEventType;
+
+/**
+ * @brief Type used to return a single completion by the GccgCompletionQueueReap() API function. It holds the same data
+ * that would otherwise be passed to the callback function of the connection.
+ */
+typedef struct {
+    /// @brief Type of the completion.
+    GccgCompletionEventType type;
+
+    /// @brief Transmit completion data. Only valid if type is kGccgCompletionEventTx.
+    GccgTxCbData tx_data;
+
+    /// @brief Receive completion data. Only valid if type is kGccgCompletionEventRx. The media elements must be freed
+    /// using the GccgRxFreeBuffer() API function, as when received through the GccgRxCallback() callback API function.
+    GccgRxCbData rx_data;
+} GccgCompletionEvent;
+
+/**
+ * Create a completion queue. Connections are attached to the queue using the completion_queue option of the
+ * GccgTxConnectionCreateEx() and GccgRxConnectionCreateEx() API functions. Any number of connections can share a queue.
+ * When the queue is no longer needed, use the GccgCompletionQueueDestroy() API function to free-up resources that are
+ * being used by it. This API is thread-safe.
+ *
+ * @param capacity Maximum number of completions held by the queue. If the queue is full, then new completions are held
+ *                 back by the SDK until completions are reaped, which also holds back the connections producing them.
+ * @param ret_queue_handle_ptr Pointer to returned completion queue handle.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgCompletionQueueCreate(int capacity, GccgCompletionQueueHandle* ret_queue_handle_ptr);
+
+/**
+ * Destroy a completion queue. All connections attached to the queue must have been destroyed first. This API is
+ * thread-safe.
+ *
+ * @param queue_handle Completion queue handle returned by the GccgCompletionQueueCreate() API function.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgCompletionQueueDestroy(GccgCompletionQueueHandle queue_handle);
+
+/**
+ * Get a file descriptor that becomes readable when the completion queue holds completions, so that it can be waited on
+ * together with other file descriptors (for example using epoll). On Linux this is an eventfd. The descriptor is owned
+ * by the queue and must not be closed or read by the application. This API is thread-safe.
+ *
+ * @param queue_handle Completion queue handle returned by the GccgCompletionQueueCreate() API function.
+ * @param ret_fd_ptr Pointer where to write the file descriptor.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgCompletionQueueGetFd(GccgCompletionQueueHandle queue_handle, int* ret_fd_ptr);
+
+/**
+ * Remove up to max_event_count completions from a completion queue, in the order they were posted. Completions of a
+ * single connection are always posted in order. Only one thread may reap a given queue at a time.
+ *
+ * Reaping a transmit completion takes the place of the GccgTxCallback() callback API function returning: slots of the
+ * payload acquired using the GccgTxBufferAcquire() or GccgTxBufferReserve() API functions are released, and ownership of
+ * the payload memory returns to the application, when this function returns the completion. Until then, the payload
+ * memory must not be modified.
+ *
+ * Note: In a single threaded event loop driven configuration, the connections must still be serviced using the
+ * GccgEventLoopPoll() or GccgEventLoopPollMany() API functions, which post completions to the queue instead of invoking
+ * callback functions.
+ *
+ * @param queue_handle Completion queue handle returned by the GccgCompletionQueueCreate() API function.
+ * @param event_array Pointer to an array of max_event_count events where to write the completions.
+ * @param max_event_count Maximum number of completions to remove.
+ * @param timeout_microsecs Maximum time in microseconds to block waiting for at least one completion. Use zero to return
+ *                          immediately and -1 to wait without a time limit.
+ * @param ret_event_count_ptr Pointer where to write the number of completions written to event_array.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If no completion was available within timeout_microsecs, then
+ *         kGccgStatusTimeoutExpired will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgCompletionQueueReap(GccgCompletionQueueHandle queue_handle,
+                                                        GccgCompletionEvent* event_array,
+                                                        int max_event_count,
+                                                        int timeout_microsecs,
+                                                        int* ret_event_count_ptr);
+
+/**
+ * @brief Type used as the handle (pointer to an opaque structure) for a pre-compiled connection template. A template
+ * holds a parsed and validated connection configuration that can be used to create any number of Tx or Rx connections.
+ */
+typedef void* GccgConnectionTemplateHandle;
+
+/**
+ * Compile a connection configuration into a template. The json string is parsed and validated once, so that connections
+ * created from the template using the GccgTxConnectionCreateEx() or GccgRxConnectionCreateEx() API functions do not need
+ * to parse and validate the level, timing and mediaFlow data again. When the template is no longer needed, use the
+ * GccgConnectionTemplateDestroy() API function to free-up resources that are being used by it. This API is thread-safe.
+ *
+ * @param connection_json_str Pointer to connection configuration data in json format. The transportParameters object is
+ *                            optional and is used as the default for connections created from the template.
+ * @param ret_template_handle_ptr Pointer to returned template handle.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the connection configuration is not valid, then
+ *         kGccgStatusInvalidParameter will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgConnectionTemplateCompile(const char* connection_json_str,
+                                                              GccgConnectionTemplateHandle* ret_template_handle_ptr);
+
+/**
+ * Destroy a connection template and free resources that were created for it. Connections previously created from the
+ * template are not affected. This API is thread-safe.
+ *
+ * @param template_handle Template handle returned by the GccgConnectionTemplateCompile() API function.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgConnectionTemplateDestroy(GccgConnectionTemplateHandle template_handle);
+
 /**
  * Create an instance of a transmitter. When the instance is no longer needed, use the GccgConnectionDestroy()
  * API function to free-up resources that are being used by it. This API is thread-safe.
@@ -183,20 +595,27 @@ GCCG_INTERFACE GccgReturnStatus GccgInitialize(int maximum_thread_count, int max
  *                            Note: The number and ordering of media elements declared in the JSON defines media_count
  *                            and the ordering in media_array when using the GccgTxPayload() API function.
  *                            The remote target must use the same configuration data when calling the
- *                            GccgRxConnectionCreate() API function to create the receive side of the connection.
+ *                            GccgRxConnectionCreate() API function to create the receive side of the connection. If
+ *                            transportParameters is an array, to fan out to several receivers, each receiver uses the
+ *                            same configuration data except that transportParameters is replaced by its own single
+ *                            object from the array.
  * @param tx_buffer_size_bytes The size in bytes of a memory region for holding transmit payload data. A pointer to the
  *                             buffer is returned in ret_tx_buffer_ptr. The application manages how the buffer is
- *                             partitioned and used.
+ *                             partitioned and used, unless the SDK managed slot pool is enabled using the
+ *                             tx_slot_size_bytes option of the GccgTxConnectionCreateEx() API function.
  * @param tx_cb_ptr Address of the user function to call whenever a payload has been transmitted.
  * @param ret_connection_json_buffer_size Size of ret_connection_json_str buffer.
  * @param ret_connection_json_str Pointer where to write returned json string. If size of buffer is not large enough,
- *                                then kGccgStatusBufferToSmall will be returned.
+ *                                then kGccgStatusBufferToSmall will be returned. If transportParameters is an array,
+ *                                a single json string is returned for the whole connection. Its tMin value is the
+ *                                smallest and its tMax value the largest of the values for each receiver.
  * @param ret_tx_buffer_ptr Pointer where to write returned start of allocated transmit payload buffer. Size is specified
  *                          using tx_buffer_size_bytes.
  * @param ret_handle_ptr Pointer to returned connection handle. The handle is used as a parameter to other API functions
  *                       to identify this specific transmitter.
  *
- * @return A value from the GccgReturnStatus enumeration.
+ * @return A value from the GccgReturnStatus enumeration. If the transport selected by transportParameters is not
+ *         supported by the implementation or not usable on this host, then kGccgStatusNotSupported will be returned.
  */
 GCCG_INTERFACE GccgReturnStatus GccgTxConnectionCreate(const char* connection_json_str,
                                                        uint64_t tx_buffer_size_bytes,
@@ -206,6 +625,236 @@ GCCG_INTERFACE GccgReturnStatus GccgTxConnectionCreate(const char* connection_js
                                                        void* ret_tx_buffer_ptr,
                                                        GccgConnectionHandle* ret_handle_ptr);
 
+/**
+ * @brief Values used to define how a transmitter that fans out to several receivers handles receivers that are slower
+ * than the others.
+ */
+typedef enum {
+    /// Each payload is transmitted to every receiver. The GccgTxCallback() callback API function is invoked once all
+    /// receivers acknowledged the payload or the timeout expired, so a slow receiver delays the completion of every
+    /// payload.
+    kGccgFanOutPolicyWaitAll  = 0,
+    /// Each receiver has its own queue of tx_fan_out_queue_depth payloads. A payload is not transmitted to a receiver
+    /// whose queue is full, so a slow receiver misses payloads instead of delaying the others.
+    kGccgFanOutPolicySkipSlow = 1
+} GccgFanOutPolicy;
+
+/**
+ * @brief Values used to define the order in which a transmitter connection transmits queued payloads.
+ */
+typedef enum {
+    /// Payloads are transmitted in submission order.
+    kGccgTxSchedulingFifo             = 0,
+    /// Queued payloads are transmitted earliest deadline first. The deadline of a payload is its COT plus its
+    /// t99Accumulated value, from payload_json_str or GccgPayloadInfo. If t99Accumulated is zero, the tMax value of the
+    /// connection is used instead. Within a payload, audio and ancillary data media elements are transmitted before
+    /// video media elements, so they are not delayed behind a large frame. Payloads may be transmitted and completed
+    /// out of submission order, so the ordering guarantees of GccgTxPayloadBatch() do not apply: the GccgTxCallback()
+    /// callback API function is invoked in completion order, and payloads of a batch may be interleaved with other
+    /// payloads.
+    kGccgTxSchedulingEarliestDeadline = 1
+} GccgTxSchedulingPolicy;
+
+/**
+ * @brief Type used to define optional settings of a transmitter connection created with the GccgTxConnectionCreateEx()
+ * API function. Fields that are not used must be set to zero, which selects the same behavior as
+ * GccgTxConnectionCreate().
+ */
+typedef struct {
+    /// @brief If not NULL, the connection is created from a template returned by the GccgConnectionTemplateCompile() API
+    /// function. In this case connection_json_str may be NULL to use the template unchanged, or may contain only a
+    /// transportParameters object, which replaces the transportParameters of the template.
+    GccgConnectionTemplateHandle template_handle;
+
+    /// @brief If non-zero, the SDK partitions the transmit payload buffer into fixed-size slots that are allocated
+    /// using the GccgTxBufferAcquire() API function. The value is rounded up to a multiple of 4 KiB, independently of
+    /// the page size used for the buffer, so each slot starts on a 4 KiB boundary (and therefore also a cache line
+    /// boundary). The number of slots is tx_buffer_size_bytes divided by the rounded slot size. If zero, the
+    /// application manages how the buffer is partitioned.
+    uint64_t tx_slot_size_bytes;
+
+    /// @brief If non-zero, the SDK manages the transmit payload buffer as a ring of variable-size slots that are
+    /// allocated using the GccgTxBufferReserve() and GccgTxBufferCommit() API functions. This suits compressed media
+    /// elements, whose size varies from payload to payload. Must not be combined with tx_slot_size_bytes.
+    int tx_variable_slot_enable;
+
+    /// @brief Policy used when the connection fans out to several receivers. See GccgFanOutPolicy.
+    GccgFanOutPolicy tx_fan_out_policy;
+
+    /// @brief Number of payloads that can be queued for each receiver when tx_fan_out_policy is
+    /// kGccgFanOutPolicySkipSlow. Must be greater than zero in that case.
+    int tx_fan_out_queue_depth;
+
+    /// @brief If not NULL, transmit completions are posted to this completion queue instead of invoking the tx_cb_ptr
+    /// callback function, which may then be NULL. Where the release of slots or payload memory is tied to the
+    /// GccgTxCallback() callback API function returning, it then happens when the completion is returned by the
+    /// GccgCompletionQueueReap() API function.
+    GccgCompletionQueueHandle completion_queue;
+
+    /// @brief Order in which queued payloads are transmitted. See GccgTxSchedulingPolicy.
+    GccgTxSchedulingPolicy tx_scheduling_policy;
+
+    /// @brief If non-zero and tx_scheduling_policy is kGccgTxSchedulingEarliestDeadline, a queued payload that can no
+    /// longer be transmitted before its deadline at the current transmit rate is dropped without being transmitted. The
+    /// GccgTxCallback() callback API function is invoked for it with kGccgStatusDeadlineMissed returned as the
+    /// status_code in GccgTxCbData. Under overload the connection then drops payloads instead of queuing them with an
+    /// ever increasing latency. A dropped payload is completed as soon as it is dropped, possibly before payloads that
+    /// were submitted earlier.
+    int tx_drop_late_enable;
+
+    /// @brief Maximum number of payloads that can be queued for transmission and not yet completed. Sizes the arena used
+    /// for internal per-payload data. If this number is reached, GccgTxPayload() (or one of its variants) returns
+    /// kGccgStatusBufferToSmall. Use zero to let the SDK derive it from tx_buffer_size_bytes and the payload size.
+    int tx_max_outstanding_payloads;
+} GccgTxConnectionOptions;
+
+/**
+ * Create an instance of a transmitter using optional settings. This is the same as the GccgTxConnectionCreate() API
+ * function, except for the additional options_ptr parameter. This API is thread-safe.
+ *
+ * @param options_ptr Pointer to optional settings of the transmitter. If NULL, then this API function behaves the same as
+ *                    GccgTxConnectionCreate().
+ *
+ * See GccgTxConnectionCreate() for a description of the other parameters.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxConnectionCreateEx(const char* connection_json_str,
+                                                         uint64_t tx_buffer_size_bytes,
+                                                         GccgTxCallback tx_cb_ptr,
+                                                         const GccgTxConnectionOptions* options_ptr,
+                                                         int ret_connection_json_buffer_size,
+                                                         char* ret_connection_json_str,
+                                                         void* ret_tx_buffer_ptr,
+                                                         GccgConnectionHandle* ret_handle_ptr);
+
+/**
+ * Add a receiver to a transmitter, so that every payload transmitted from then on is delivered to it in addition to the
+ * existing receivers. The media data of each payload is transmitted from the same transmit buffer, so the buffer memory
+ * is not duplicated. Receivers can also be declared when the connection is created, by using an array of
+ * transportParameters objects in the connection configuration data. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the transmitter create connection functions.
+ * @param transport_parameters_json_str Pointer to a json string holding the transportParameters object of the receiver.
+ * @param ret_connection_json_buffer_size Size of ret_connection_json_str buffer.
+ * @param ret_connection_json_str Pointer where to write returned json string for the receiver. If size of buffer is not
+ *                                large enough, then kGccgStatusBufferToSmall will be returned.
+ * @param ret_receiver_index_ptr Pointer where to write the index of the receiver, used with the
+ *                               GccgTxConnectionRemoveReceiver() API function.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxConnectionAddReceiver(GccgConnectionHandle handle,
+                                                            const char* transport_parameters_json_str,
+                                                            int ret_connection_json_buffer_size,
+                                                            char* ret_connection_json_str,
+                                                            int* ret_receiver_index_ptr);
+
+/**
+ * Remove a receiver from a transmitter. Payloads already queued for the receiver are canceled for that receiver only.
+ * This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the transmitter create connection functions.
+ * @param receiver_index Index of the receiver. Receivers declared in the connection configuration data use the index of
+ *                       their transportParameters object. Receivers added using the GccgTxConnectionAddReceiver() API
+ *                       function use the returned index.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxConnectionRemoveReceiver(GccgConnectionHandle handle, int receiver_index);
+
+/**
+ * Get the layout of the slot pool of a transmitter. The connection must have been created with the tx_slot_size_bytes
+ * option set. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreateEx() API function.
+ * @param ret_slot_size_bytes_ptr Pointer where to write the size in bytes of each slot, after rounding up to a multiple
+ *                                of 4 KiB.
+ * @param ret_slot_count_ptr Pointer where to write the total number of slots in the pool.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxBufferGetPoolInfo(GccgConnectionHandle handle,
+                                                        uint64_t* ret_slot_size_bytes_ptr,
+                                                        int* ret_slot_count_ptr);
+
+/**
+ * Acquire a free slot from the slot pool of a transmitter. The connection must have been created with the
+ * tx_slot_size_bytes option set. The application fills the slot with media data and references it using address_ptr of
+ * one or more media elements passed to the GccgTxPayload() API function (or one of its variants). The slot is released
+ * automatically after the GccgTxCallback() callback API function for that payload returns, or, if the connection uses
+ * a completion queue, when its completion is returned by the GccgCompletionQueueReap() API function, regardless of the
+ * status_code. A slot that is not passed to GccgTxPayload() must be released using the GccgTxBufferRelease() API
+ * function. This API is thread-safe and lock-free, so it can be called from several producer threads at the same time.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreateEx() API function.
+ * @param timeout_microsecs Maximum time in microseconds to wait for a slot to become free. Use zero to return
+ *                          immediately if no slot is free.
+ * @param ret_slot_ptr Pointer where to write the start address of the acquired slot.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If no slot became free within timeout_microsecs, then
+ *         kGccgStatusTimeoutExpired will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxBufferAcquire(GccgConnectionHandle handle,
+                                                    int timeout_microsecs,
+                                                    void** ret_slot_ptr);
+
+/**
+ * Release a slot that was acquired using the GccgTxBufferAcquire() or GccgTxBufferReserve() API functions without
+ * transmitting it. Slots used by a transmitted payload are released by the SDK and must not be passed to this function.
+ * This API is thread-safe.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreateEx() API function.
+ * @param slot_ptr Start address of the slot, as returned by GccgTxBufferAcquire() or GccgTxBufferReserve().
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxBufferRelease(GccgConnectionHandle handle, void* slot_ptr);
+
+/**
+ * Reserve a variable-size slot in the transmit payload buffer. The connection must have been created with the
+ * tx_variable_slot_enable option set. The slot is reserved with the largest size the media element may need, for
+ * example the worst case size of an encoded frame, and trimmed to the size actually used with the GccgTxBufferCommit()
+ * API function once the data has been written. Committed slots are used and released the same way as slots returned by
+ * the GccgTxBufferAcquire() API function. This API is thread-safe.
+ *
+ * The buffer is used as a ring. Memory of released slots is reused in allocation order, so a slot that stays in flight
+ * for a long time prevents memory of later slots from being reused.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreateEx() API function.
+ * @param reserve_size_bytes Maximum size in bytes of the slot.
+ * @param timeout_microsecs Maximum time in microseconds to wait for enough free space. Use zero to return immediately if
+ *                          there is not enough space.
+ * @param ret_slot_ptr Pointer where to write the start address of the reserved slot. The address is aligned to a cache
+ *                     line.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If reserve_size_bytes is larger than the buffer, then
+ *         kGccgStatusBufferToSmall will be returned. If not enough space became free within timeout_microsecs, then
+ *         kGccgStatusTimeoutExpired will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxBufferReserve(GccgConnectionHandle handle,
+                                                    uint64_t reserve_size_bytes,
+                                                    int timeout_microsecs,
+                                                    void** ret_slot_ptr);
+
+/**
+ * Trim a slot reserved using the GccgTxBufferReserve() API function to the size actually used. If the slot is still the
+ * most recent reservation, the unused tail of the slot is returned to the buffer immediately and the next reservation
+ * starts right after the used data. Otherwise another reservation already follows the slot in the ring, and the unused
+ * tail is only reclaimed when ring order reaches it, once the slot is released. To keep the ring compact, reserve and
+ * commit each slot before reserving the next one, for example by using a single producer thread per connection. This
+ * API is thread-safe.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreateEx() API function.
+ * @param slot_ptr Start address of the slot, as returned by GccgTxBufferReserve().
+ * @param used_size_bytes Number of bytes of the slot that hold data. Must not exceed the reserved size.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxBufferCommit(GccgConnectionHandle handle,
+                                                   void* slot_ptr,
+                                                   uint64_t used_size_bytes);
+
 /**
  * Create an instance of a receiver. When the instance is no longer needed, use the GccgConnectionDestroy()
  * API function to free-up resources that are being used by it. This API is thread-safe.
@@ -214,7 +863,10 @@ GCCG_INTERFACE GccgReturnStatus GccgTxConnectionCreate(const char* connection_js
  *                            Note: The number and ordering of media elements declared in the JSON defines media_count
  *                            and the ordering in media_array when the GccgRxCallback() callback API function is invoked.
  *                            The remote host must use the same configuration data when calling the
- *                            GccgTxConnectionCreate() API function to create the transmit side of the connection.
+ *                            GccgTxConnectionCreate() API function to create the transmit side of the connection. If
+ *                            the transmitter fans out to several receivers, transportParameters must be a single object:
+ *                            the entry of the transmitter's transportParameters array for this receiver, or the object
+ *                            passed to the GccgTxConnectionAddReceiver() API function.
  * @param rx_buffer_size_bytes The size in bytes of a memory region for holding received payload data.
  * @param rx_cb_ptr Address of the user function to call whenever a payload has been received.
  * @param user_cb_param_ptr User defined callback parameter. This value is set as part of the GccgRxCbData data
@@ -225,7 +877,8 @@ GCCG_INTERFACE GccgReturnStatus GccgTxConnectionCreate(const char* connection_js
  * @param ret_handle_ptr Pointer to returned connection handle. The handle is used as a parameter to other API functions
  *                       to identify this specific receiver.
  *
- * @return A value from the GccgReturnStatus enumeration.
+ * @return A value from the GccgReturnStatus enumeration. If the transport selected by transportParameters is not
+ *         supported by the implementation or not usable on this host, then kGccgStatusNotSupported will be returned.
  */
 GCCG_INTERFACE GccgReturnStatus GccgRxConnectionCreate(const char *connection_json_str,
                                                        uint64_t rx_buffer_size_bytes,
@@ -235,6 +888,120 @@ GCCG_INTERFACE GccgReturnStatus GccgRxConnectionCreate(const char *connection_js
                                                        char* ret_connection_json_str,
                                                        GccgConnectionHandle* ret_handle_ptr);
 
+/**
+ * @brief Values used to identify the kind of memory provided by the application for a payload buffer.
+ */
+typedef enum {
+    /// Host memory. May be backed by regular or huge pages.
+    kGccgMemoryTypeHost   = 0,
+    /// Device memory such as GPU memory that is not accessible by the CPU. The transport must be able to access the
+    /// memory directly, otherwise kGccgStatusInvalidParameter is returned when the connection is created.
+    kGccgMemoryTypeDevice = 1
+} GccgMemoryType;
+
+/**
+ * @brief Type used to define optional settings of a receiver connection created with the GccgRxConnectionCreateEx() API
+ * function. Fields that are not used must be set to zero, which selects the same behavior as GccgRxConnectionCreate().
+ */
+typedef struct {
+    /// @brief If non-zero, the SDK does not produce a payload configuration json string for received payloads and
+    /// payload_json_str in GccgRxCbData is set to NULL. The timing and attribute change information is available
+    /// through payload_info_ptr.
+    int payload_json_disable;
+
+    /// @brief If not NULL, the connection is created from a template returned by the GccgConnectionTemplateCompile() API
+    /// function. In this case connection_json_str may be NULL to use the template unchanged, or may contain only a
+    /// transportParameters object, which replaces the transportParameters of the template.
+    GccgConnectionTemplateHandle template_handle;
+
+    /// @brief If not NULL, the start address of an application owned memory region of rx_buffer_size_bytes that is used
+    /// to hold received payload data instead of memory allocated by the SDK. The region must start on a page boundary
+    /// and must remain valid until the connection is destroyed. The transport writes received data directly into the
+    /// region, so media elements passed to the GccgRxCallback() callback API function point into it. Not supported by the
+    /// shared-memory transport (urn:x-gccg:transport:shm), where media elements point into the transmit payload buffer.
+    void* rx_buffer_ptr;
+
+    /// @brief The kind of memory of rx_buffer_ptr. Ignored if rx_buffer_ptr is NULL.
+    GccgMemoryType rx_buffer_memory_type;
+
+    /// @brief If non-zero, the receive buffer is partitioned into fixed-size slots and each received payload is written
+    /// into a single slot. The value is rounded up to a multiple of 4 KiB, independently of the page size used for the
+    /// buffer. A slot is returned to the pool when the GccgRxFreeBuffer() API function is called for the payload, so
+    /// the number of slots defines the maximum number of payloads the application can hold at any time. If no slot is
+    /// free, then newly arriving payloads are held back by the transport until a slot is freed.
+    uint64_t rx_slot_size_bytes;
+
+    /// @brief If non-zero, received payloads are stored one after the other in the receive buffer, each using only the
+    /// space it needs. This suits compressed media elements, so the memory used follows the actual bitrate instead of the
+    /// largest payload. Memory of freed payloads is reused in arrival order. Must not be combined with
+    /// rx_slot_size_bytes.
+    int rx_variable_slot_enable;
+
+    /// @brief Bit mask of the media elements to receive, where bit N selects the media element at index N of the
+    /// connection. Media elements that are not selected are not transferred by the transport and do not use receive
+    /// buffer memory. Their pointers in media_array are always NULL. Use zero to receive all media elements. Only the
+    /// first 64 media elements of a connection can be deselected.
+    uint64_t rx_element_mask;
+
+    /// @brief If not NULL, address of the user function to call as lines of raw video media elements are received. See
+    /// GccgRxSliceCallback().
+    GccgRxSliceCallback rx_slice_cb_ptr;
+
+    /// @brief Minimum number of new lines between two invocations of rx_slice_cb_ptr for the same media element. Use zero
+    /// to invoke it whenever the transmitter commits lines.
+    int rx_slice_line_count;
+
+    /// @brief If not NULL, receive completions are posted to this completion queue instead of invoking the rx_cb_ptr
+    /// callback function, which may then be NULL. The user_cb_param_ptr value is still set in the posted GccgRxCbData.
+    GccgCompletionQueueHandle completion_queue;
+
+    /// @brief If non-zero, received payloads are held in the receive payload buffer and released to the application,
+    /// through rx_cb_ptr or completion_queue, when the SDK clock reaches the COT of the payload plus the target latency.
+    /// Payloads are released in COT order. A payload that arrives after its release time is released immediately. The
+    /// receive payload buffer must be large enough to hold all payloads received during the target latency.
+    int rx_jitter_buffer_enable;
+
+    /// @brief Target latency of the jitter buffer in microseconds. Use zero to use the t99Accumulated value of each
+    /// payload. Ignored if rx_jitter_buffer_enable is zero.
+    int rx_target_latency_microsecs;
+
+    /// @brief If non-zero, the jitter buffers of all Rx connections that use the same value and whose timing uses the
+    /// same GMID are aligned: each payload is released at its COT plus the largest target latency of the group, so
+    /// payloads with the same COT are released together across connections. Ignored if rx_jitter_buffer_enable is zero.
+    int rx_sync_group_id;
+
+    /// @brief Maximum number of payloads that can be received and not yet freed using the GccgRxFreeBuffer() API
+    /// function. Sizes the arena used for internal per-payload data. Payloads received while this number is reached are
+    /// dropped and counted as errors in GccgConnectionStats. Use zero to let the SDK derive it from rx_buffer_size_bytes
+    /// and the payload size.
+    int rx_max_outstanding_payloads;
+
+    /// @brief If non-zero, credits are only granted to the transmitter using the GccgRxGrantCredits() API function.
+    /// Otherwise the SDK grants credits automatically as received payloads are freed using the GccgRxFreeBuffer() API
+    /// function.
+    int rx_manual_credit_enable;
+} GccgRxConnectionOptions;
+
+/**
+ * Create an instance of a receiver using optional settings. This is the same as the GccgRxConnectionCreate() API
+ * function, except for the additional options_ptr parameter. This API is thread-safe.
+ *
+ * @param options_ptr Pointer to optional settings of the receiver. If NULL, then this API function behaves the same as
+ *                    GccgRxConnectionCreate().
+ *
+ * See GccgRxConnectionCreate() for a description of the other parameters.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgRxConnectionCreateEx(const char *connection_json_str,
+                                                         uint64_t rx_buffer_size_bytes,
+                                                         GccgRxCallback rx_cb_ptr,
+                                                         void* user_cb_param_ptr,
+                                                         const GccgRxConnectionOptions* options_ptr,
+                                                         int ret_connection_json_buffer_size,
+                                                         char* ret_connection_json_str,
+                                                         GccgConnectionHandle* ret_handle_ptr);
+
 /**
  * Destroy a specific Tx or Rx connection and free resources that were created for it. This API is thread-safe.
  *
@@ -245,15 +1012,52 @@ GCCG_INTERFACE GccgReturnStatus GccgRxConnectionCreate(const char *connection_js
 GCCG_INTERFACE GccgReturnStatus GccgConnectionDestroy(GccgConnectionHandle handle);
 
 /**
- * Transmit a payload of data to the receiver. The connection must have been created with GccgTxConnectionCreate().
- * This function is asynchronous and will immediately return. The user callback function GccgTxCallback() registered
- * through GccgTxConnectionCreate() will be invoked when the payload has been acknowledged by the remote receiver or a
- * transmission timeout occurred. This API is thread-safe.
+ * Change the media element attributes and timing of an existing Tx or Rx connection without destroying it. The payload
+ * buffer, its registration with the transport and the transport session are kept, so the flow is not interrupted.
  *
- * @param handle Connection handle returned by the GccgTxConnectionCreate() API function.
- * @param payload_json_str Pointer to payload configuration json string.
- * @param media_array Array of media elements that define the size and location of each media element to transmit in this
- *                    payload. If a pointer within the array is NULL, then the payload does not contain an element for
+ * The change is applied at a payload boundary. For a Tx connection, payloads passed to GccgTxPayload() (or one of its
+ * variants) before this function returns use the previous configuration, and later payloads use the new one. The new
+ * configuration is carried in-band with the first payload that uses it, whose changed_attributes_array has the
+ * kGccgAttributeChangeReconfigured flag set.
+ *
+ * An Rx connection adopts the configuration of its transmitter automatically when that flagged payload arrives, so the
+ * receiving application does not need to call this function and no payload is rejected while the change propagates.
+ * If the receive payload buffer, or its slots, cannot hold a payload of the new configuration, then the payload is
+ * completed with kGccgStatusBufferToSmall as the status_code in GccgRxCbData. Calling this function on an Rx
+ * connection only changes the timing values of the receiving Workflow Step, which are not carried from the
+ * transmitter, and checks in advance that the receive payload buffer can hold the media element attributes given in
+ * connection_json_str. The media element attributes actually used are still those of the transmitter. This API is
+ * thread-safe.
+ *
+ * @param handle Connection handle returned by one of the ...ConnectionCreate() API functions.
+ * @param connection_json_str Pointer to connection configuration json string, using the same schema as when creating the
+ *                            connection. The number of media elements and their types must not change. The
+ *                            transportParameters object may be omitted and, if present, must not change.
+ * @param ret_connection_json_buffer_size Size of ret_connection_json_str buffer.
+ * @param ret_connection_json_str Pointer where to write returned json string, as for the ...ConnectionCreate() API
+ *                                functions. If size of buffer is not large enough, then kGccgStatusBufferToSmall will be
+ *                                returned.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the payload buffer, or its slots, cannot hold a payload of
+ *         the new configuration, then kGccgStatusBufferToSmall will be returned. If the change cannot be applied without
+ *         re-creating the transport session, then kGccgStatusNotSupported will be returned. In these cases the
+ *         connection is not changed, and must be destroyed and re-created to apply the new configuration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgConnectionReconfigure(GccgConnectionHandle handle,
+                                                          const char* connection_json_str,
+                                                          int ret_connection_json_buffer_size,
+                                                          char* ret_connection_json_str);
+
+/**
+ * Transmit a payload of data to the receiver. The connection must have been created with GccgTxConnectionCreate().
+ * This function is asynchronous and will immediately return. The user callback function GccgTxCallback() registered
+ * through GccgTxConnectionCreate() will be invoked when the payload has been acknowledged by the remote receiver or a
+ * transmission timeout occurred. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreate() API function.
+ * @param payload_json_str Pointer to payload configuration json string.
+ * @param media_array Array of media elements that define the size and location of each media element to transmit in this
+ *                    payload. If a pointer within the array is NULL, then the payload does not contain an element for
  *                    that media.
  * @param user_cb_param_ptr User defined callback parameter. This value is set as part of the GccgTxCbData data
  *                          whenever the tx_cb_ptr callback function specified in the GccgTxConnectionCreate() API
@@ -271,7 +1075,140 @@ GCCG_INTERFACE GccgReturnStatus GccgTxPayload(GccgConnectionHandle handle,
                                               int timeout_microsecs);
 
 /**
- * Free an array of receive buffers that was used by the GccgRxCallback() callback API function. This API is thread-safe.
+ * Transmit a payload of data to the receiver using binary payload information. This is the same as the GccgTxPayload()
+ * API function, except that the timing data of the payload is defined by payload_info_ptr instead of a json string. A
+ * payload configuration json string is only required for payloads that change media element attributes. This API is
+ * thread-safe.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreate() API function.
+ * @param payload_info_ptr Pointer to the timing and attribute change information of the payload. The lat field is
+ *                         ignored. The data is copied by the SDK before this function returns.
+ * @param payload_json_str Pointer to payload configuration json string that defines the new values of the attributes
+ *                         flagged in changed_attributes_array of payload_info_ptr. Timing values in the json string are
+ *                         ignored. May be NULL if no attributes changed.
+ * @param media_array Array of media elements that define the size and location of each media element to transmit in this
+ *                    payload. If a pointer within the array is NULL, then the payload does not contain an element for
+ *                    that media.
+ * @param user_cb_param_ptr User defined callback parameter. This value is set as part of the GccgTxCbData data
+ *                          whenever the tx_cb_ptr callback function specified in the GccgTxConnectionCreate() API
+ *                          is invoked. The value is not modified by the SDK.
+ * @param timeout_microsecs Timeout period in microseconds. If the payload is not transmitted within this period,
+ *                          transmission is canceled and the GccgTxCallback() callback API function invoked with
+ *                          kGccgStatusTimeoutExpired returned as the status_code in GccgTxCbData.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxPayloadEx(GccgConnectionHandle handle,
+                                                const GccgPayloadInfo* payload_info_ptr,
+                                                const char *payload_json_str,
+                                                GccgMediaElements media_array,
+                                                void* user_cb_param_ptr,
+                                                int timeout_microsecs);
+
+/**
+ * @brief Type used to define a single payload within a batch of payloads passed to the GccgTxPayloadBatch() API
+ * function. The fields have the same meaning as the parameters of the same name of the GccgTxPayload() API function.
+ */
+typedef struct {
+    /// @brief Pointer to payload configuration json string.
+    const char* payload_json_str;
+
+    /// @brief Array of media elements that define the size and location of each media element to transmit in this
+    /// payload. If a pointer within the array is NULL, then the payload does not contain an element for that media.
+    GccgMediaElements media_array;
+
+    /// @brief User defined callback parameter. This value is set as part of the GccgTxCbData data whenever the
+    /// tx_cb_ptr callback function is invoked for this payload. The value is not modified by the SDK.
+    void* user_cb_param_ptr;
+
+    /// @brief Optional pointer to the timing and attribute change information of the payload. If not NULL, the payload
+    /// is transmitted as if by the GccgTxPayloadEx() API function and payload_json_str may be NULL.
+    const GccgPayloadInfo* payload_info_ptr;
+} GccgTxPayloadBatchEntry;
+
+/**
+ * Transmit a batch of payloads to the receiver. This is equivalent to calling the GccgTxPayload() API function once for
+ * each entry in the batch, except that all of the payloads are queued for transmission together and the transport is
+ * only signaled once. The connection must have been created with GccgTxConnectionCreate(). This function is
+ * asynchronous and will immediately return. This API is thread-safe.
+ *
+ * The user callback function GccgTxCallback() is invoked once for each payload in the batch, in the same order that the
+ * payloads appear in entry_array. Payloads queued from a single call are never interleaved with payloads queued by other
+ * calls to GccgTxPayload() or GccgTxPayloadBatch() on the same connection. These ordering guarantees only hold if the
+ * connection uses kGccgTxSchedulingFifo, the default. With kGccgTxSchedulingEarliestDeadline, payloads are transmitted
+ * and completed in deadline order.
+ *
+ * If a value other than kGccgStatusOk is returned, then none of the payloads in the batch were queued and the callback
+ * function will not be invoked for any of them.
+ *
+ * @param handle Connection handle returned by the GccgTxConnectionCreate() API function.
+ * @param entry_array Pointer to the start of an array of payloads to transmit.
+ * @param entry_count Number of payloads in entry_array. Must be greater than zero.
+ * @param timeout_microsecs Timeout period in microseconds, applied to each payload in the batch. If a payload is not
+ *                          transmitted within this period, transmission of that payload is canceled and the
+ *                          GccgTxCallback() callback API function invoked with kGccgStatusTimeoutExpired returned as the
+ *                          status_code in GccgTxCbData.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxPayloadBatch(GccgConnectionHandle handle,
+                                                   const GccgTxPayloadBatchEntry* entry_array,
+                                                   int entry_count,
+                                                   int timeout_microsecs);
+
+/**
+ * @brief Type used as the handle (pointer to an opaque structure) for a payload that is transmitted progressively using
+ * the GccgTxPayloadStart() and GccgTxPayloadCommitLines() API functions.
+ */
+typedef void* GccgPayloadHandle;
+
+/**
+ * Start transmitting a payload before all of its raw video media elements are complete. This is the same as the
+ * GccgTxPayloadEx() API function, except that raw video media elements are transmitted progressively as lines are
+ * committed using the GccgTxPayloadCommitLines() API function. All other media elements must be complete when this
+ * function is called. The user callback function GccgTxCallback() is invoked once the complete payload has been
+ * transmitted or the timeout expired. This API is thread-safe.
+ *
+ * @param ret_payload_handle_ptr Pointer to returned payload handle. The handle is used as a parameter to the
+ *                               GccgTxPayloadCommitLines() API function and remains valid until all lines of every raw
+ *                               video media element have been committed.
+ *
+ * See GccgTxPayloadEx() for a description of the other parameters. payload_info_ptr may be NULL, in which case the timing
+ * data is taken from payload_json_str.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxPayloadStart(GccgConnectionHandle handle,
+                                                   const GccgPayloadInfo* payload_info_ptr,
+                                                   const char *payload_json_str,
+                                                   GccgMediaElements media_array,
+                                                   void* user_cb_param_ptr,
+                                                   int timeout_microsecs,
+                                                   GccgPayloadHandle* ret_payload_handle_ptr);
+
+/**
+ * Commit lines of a raw video media element of a payload started using the GccgTxPayloadStart() API function. The lines
+ * at the start of the media element up to committed_line_count are complete and may be transmitted. Lines are counted
+ * in the order they are stored in the pgroup data, so for interlaced video all lines of the first field come first.
+ * Committed lines must not be modified until the GccgTxCallback() callback API function for the payload is invoked,
+ * or its completion is reaped if the connection uses a completion queue. This API is thread-safe.
+ *
+ * @param payload_handle Payload handle returned by the GccgTxPayloadStart() API function.
+ * @param element_index Index in media_array of the raw video media element.
+ * @param committed_line_count Total number of lines committed so far. Must not be smaller than the value of a previous
+ *                             call for the same element. The value must not exceed the height of the element (or of
+ *                             partialFrame, if present).
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxPayloadCommitLines(GccgPayloadHandle payload_handle,
+                                                         int element_index,
+                                                         int committed_line_count);
+
+/**
+ * Free an array of receive buffers that was used by the GccgRxCallback() callback API function. If the connection was
+ * created with the rx_slot_size_bytes option set, then the slot holding the payload is returned to the pool of the
+ * connection without using a general purpose allocator, and this API is lock-free. This API is thread-safe.
  *
  * @param media_array Pointer to a structure that contains an array of media elements to free and the number of elements
  *                    in the array.
@@ -280,6 +1217,119 @@ GCCG_INTERFACE GccgReturnStatus GccgTxPayload(GccgConnectionHandle handle,
  */
 GCCG_INTERFACE GccgReturnStatus GccgRxFreeBuffer(GccgMediaElements *media_array);
 
+/**
+ * Produce the payload configuration json string of a received payload. This is intended for connections created with the
+ * payload_json_disable option set, where payload_json_str in GccgRxCbData is NULL. It must be called before the media
+ * elements of the payload are freed using the GccgRxFreeBuffer() API function. This API is thread-safe.
+ *
+ * @param data_ptr Pointer to the GccgRxCbData structure passed to the GccgRxCallback() callback API function.
+ * @param ret_payload_json_buffer_size Size of ret_payload_json_str buffer.
+ * @param ret_payload_json_str Pointer where to write returned json string. If size of buffer is not large enough, then
+ *                             kGccgStatusBufferToSmall will be returned.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgRxGetPayloadJson(const GccgRxCbData* data_ptr,
+                                                     int ret_payload_json_buffer_size,
+                                                     char* ret_payload_json_str);
+
+/**
+ * Get the number of lines of a raw video media element that have been received. The connection must have been created
+ * with the rx_slice_cb_ptr option set, since the media element is only available to the application once it has been
+ * passed to the GccgRxSliceCallback() callback API function. This can be used in addition to that callback, for example
+ * by a worker thread that processes the element, to poll for lines received since the last invocation. Lines below the
+ * returned count are complete and may be read. Lines are counted in the same order as committed_line_count of
+ * GccgRxSliceCbData. This API is thread-safe.
+ *
+ * @param element_ptr Pointer to a raw video media element passed to the GccgRxSliceCallback() callback API function.
+ * @param ret_committed_line_count_ptr Pointer where to write the number of lines received.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgRxGetCommittedLines(const GccgMediaElement* element_ptr,
+                                                        int* ret_committed_line_count_ptr);
+
+/**
+ * Get the credits of a transmitter. Credits are the number of payloads and bytes that the receiver can currently accept
+ * in its receive payload buffer, minus those already queued for transmission. A payload transmitted without enough
+ * credits waits in the transmit queue until the receiver grants them, or until its timeout expires. For a fan-out
+ * connection, the credits of the receiver with the fewest are returned. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the ...TxConnectionCreate() API functions.
+ * @param ret_payload_credits_ptr Pointer where to write the number of payloads the receiver can accept. May be NULL.
+ * @param ret_byte_credits_ptr Pointer where to write the number of bytes the receiver can accept. May be NULL.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxGetCredits(GccgConnectionHandle handle,
+                                                 int* ret_payload_credits_ptr,
+                                                 uint64_t* ret_byte_credits_ptr);
+
+/**
+ * @brief A structure of this type is passed as the parameter to GccgCreditCallback().
+ */
+typedef struct {
+    /// @brief The handle of the transmitter whose credits crossed a watermark.
+    GccgConnectionHandle connection_handle;
+
+    /// @brief Number of payloads the receiver can accept, as returned by GccgTxGetCredits().
+    int payload_credits;
+
+    /// @brief Number of bytes the receiver can accept, as returned by GccgTxGetCredits().
+    uint64_t byte_credits;
+
+    /// @brief Non-zero if byte_credits fell below the low watermark, zero if it rose above the high watermark.
+    int below_low_watermark;
+
+    /// @brief User defined callback parameter. This value is set as a parameter of the GccgTxSetCreditCallback() API
+    /// function. The value is not modified by the SDK.
+    void* user_cb_param_ptr;
+} GccgCreditCbData;
+
+/**
+ * @brief Prototype of the credit callback function. It is invoked when the credits of a transmitter cross a watermark
+ * set using the GccgTxSetCreditCallback() API function. The same threading rules as for the GccgTxCallback() callback
+ * API function apply.
+ *
+ * @param data_ptr A pointer to a GccgCreditCbData structure.
+ */
+typedef void (*GccgCreditCallback)(const GccgCreditCbData* data_ptr);
+
+/**
+ * Register a callback function that is invoked when the byte credits of a transmitter fall below low_watermark_bytes,
+ * and again when they then rise above high_watermark_bytes. The gap between the two watermarks avoids repeated
+ * invocations while the credits hover around a single value. The application can use it to throttle, skip rendering or
+ * lower the encoding quality before the receive buffer runs out. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the ...TxConnectionCreate() API functions.
+ * @param low_watermark_bytes Byte credits below which credit_cb_ptr is invoked.
+ * @param high_watermark_bytes Byte credits above which credit_cb_ptr is invoked after falling below
+ *                             low_watermark_bytes. Must not be smaller than low_watermark_bytes.
+ * @param credit_cb_ptr Address of the user function to call. Use NULL to remove a previously registered callback.
+ * @param user_cb_param_ptr User defined callback parameter. This value is set as part of the GccgCreditCbData data
+ *                          whenever the credit_cb_ptr callback function is invoked. The value is not modified by the SDK.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTxSetCreditCallback(GccgConnectionHandle handle,
+                                                        uint64_t low_watermark_bytes,
+                                                        uint64_t high_watermark_bytes,
+                                                        GccgCreditCallback credit_cb_ptr,
+                                                        void* user_cb_param_ptr);
+
+/**
+ * Grant credits to the transmitter of a receiver created with the rx_manual_credit_enable option. The credits are added
+ * to those already granted and are sent to the transmitter immediately. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by the GccgRxConnectionCreateEx() API function.
+ * @param payload_count Number of additional payloads the transmitter may send.
+ * @param byte_count Number of additional bytes the transmitter may send.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the connection was not created with the
+ *         rx_manual_credit_enable option, then kGccgStatusInvalidParameter will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgRxGrantCredits(GccgConnectionHandle handle, int payload_count, uint64_t byte_count);
+
 /**
  * @brief Only required when using a single-threaded, event loop to service the API. Must specify a value of zero for
  *        maximum_thread_count when invoking the GccgInitialize() API function.
@@ -290,4 +1340,409 @@ GCCG_INTERFACE GccgReturnStatus GccgRxFreeBuffer(GccgMediaElements *media_array)
  */
 GCCG_INTERFACE GccgReturnStatus GccgEventLoopPoll(GccgConnectionHandle handle);
 
+/**
+ * @brief Type used as the handle (pointer to an opaque structure) for a poll group. A poll group is a set of connections
+ * that are serviced together using the GccgEventLoopPollMany() API function.
+ */
+typedef void* GccgPollGroupHandle;
+
+/**
+ * @brief Only required when using a single-threaded, event loop to service the API. Create an empty poll group. When
+ *        the poll group is no longer needed, use the GccgPollGroupDestroy() API function to free-up resources that are
+ *        being used by it.
+ *
+ * @param ret_group_handle_ptr Pointer to returned poll group handle.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgPollGroupCreate(GccgPollGroupHandle* ret_group_handle_ptr);
+
+/**
+ * @brief Destroy a poll group. Connections that were added to the group are not destroyed.
+ *
+ * @param group_handle Poll group handle returned by the GccgPollGroupCreate() API function.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgPollGroupDestroy(GccgPollGroupHandle group_handle);
+
+/**
+ * @brief Add a connection to a poll group. A connection can only be part of one poll group at a time and, once added,
+ *        must not be serviced using the GccgEventLoopPoll() API function.
+ *
+ * @param group_handle Poll group handle returned by the GccgPollGroupCreate() API function.
+ * @param handle Connection handle returned by one of the create connection functions.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgPollGroupAdd(GccgPollGroupHandle group_handle, GccgConnectionHandle handle);
+
+/**
+ * @brief Remove a connection from a poll group. This must be done before the connection is destroyed.
+ *
+ * @param group_handle Poll group handle returned by the GccgPollGroupCreate() API function.
+ * @param handle Connection handle previously added to the group using the GccgPollGroupAdd() API function.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgPollGroupRemove(GccgPollGroupHandle group_handle, GccgConnectionHandle handle);
+
+/**
+ * @brief Only required when using a single-threaded, event loop to service the API. Service every connection of a poll
+ *        group that has work ready, invoking the GccgTxCallback() and GccgRxCallback() callback API functions of those
+ *        connections. Connections without work ready are not visited. Must specify a value of zero for
+ *        maximum_thread_count when invoking the GccgInitialize() API function.
+ *
+ * @param group_handle Poll group handle returned by the GccgPollGroupCreate() API function.
+ * @param timeout_microsecs Maximum time in microseconds to block waiting for any connection of the group to become
+ *                          ready. Use zero to return immediately if no connection is ready and -1 to wait without a
+ *                          time limit.
+ * @param time_budget_microsecs Maximum time in microseconds to spend servicing ready connections once at least one is
+ *                              ready. Remaining work is serviced by the next call. Use -1 to service all ready work.
+ * @param ret_callback_count_ptr Pointer where to write the number of callback functions that were invoked. May be NULL.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If no connection became ready within timeout_microsecs, then
+ *         kGccgStatusTimeoutExpired will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgEventLoopPollMany(GccgPollGroupHandle group_handle,
+                                                      int timeout_microsecs,
+                                                      int time_budget_microsecs,
+                                                      int* ret_callback_count_ptr);
+
+/// Number of buckets in a GccgLatencyHistogram.
+#define GCCG_LATENCY_HISTOGRAM_BUCKET_COUNT 128
+
+/**
+ * @brief Type used to define a histogram of latency values measured in microseconds. Buckets use a log-linear layout
+ * with four sub-buckets per power of two, so each bucket is at most 25% wide relative to its lower bound:
+ *
+ * - A value v less than 8 is counted in bucket v.
+ * - Otherwise, with e = floor(log2(v)), the value is counted in bucket 4 * e - 4 + ((v >> (e - 2)) & 3). Values that
+ *   would fall beyond the last bucket are counted in the last bucket.
+ *
+ * The histogram is cumulative from the time the connection was created. The difference between two snapshots gives
+ * the histogram of the period between them.
+ */
+typedef struct {
+    /// @brief Total number of values counted in the histogram.
+    uint64_t sample_count;
+
+    /// @brief Smallest value counted, in microseconds. Zero if sample_count is zero.
+    uint64_t minimum_microsecs;
+
+    /// @brief Largest value counted, in microseconds. Zero if sample_count is zero.
+    uint64_t maximum_microsecs;
+
+    /// @brief Number of values counted in each bucket.
+    uint64_t bucket_array[GCCG_LATENCY_HISTOGRAM_BUCKET_COUNT];
+} GccgLatencyHistogram;
+
+/**
+ * @brief Type used to return the statistics of a connection by the GccgConnectionGetStats() API function. Counters are
+ * cumulative from the time the connection was created. Fields that do not apply to the direction of the connection are
+ * set to zero.
+ */
+typedef struct {
+    /// @brief Number of payloads transmitted and acknowledged by the receiver.
+    uint64_t payloads_sent;
+
+    /// @brief Number of media element bytes transmitted and acknowledged by the receiver.
+    uint64_t bytes_sent;
+
+    /// @brief Number of payloads received and passed to the GccgRxCallback() callback API function.
+    uint64_t payloads_received;
+
+    /// @brief Number of media element bytes received and passed to the GccgRxCallback() callback API function.
+    uint64_t bytes_received;
+
+    /// @brief Number of payloads completed with a status_code of kGccgStatusTimeoutExpired.
+    uint64_t timeouts;
+
+    /// @brief Number of payloads completed with a status_code other than kGccgStatusOk, kGccgStatusTimeoutExpired or
+    /// kGccgStatusDeadlineMissed.
+    uint64_t errors;
+
+    /// @brief Number of transport level retransmissions.
+    uint64_t retransmits;
+
+    /// @brief Number of payloads currently queued for transmission and not yet completed (Tx), or received and not yet
+    /// freed using the GccgRxFreeBuffer() API function (Rx).
+    uint64_t queue_depth;
+
+    /// @brief Largest value of queue_depth observed.
+    uint64_t queue_depth_maximum;
+
+    /// @brief Tx only. Time from a payload being passed to GccgTxPayload() (or one of its variants) until it was
+    /// acknowledged by the receiver.
+    GccgLatencyHistogram submit_to_ack_latency;
+
+    /// @brief Time from the Content Origination Timestamp (COT) to the Local Arrival Timestamp (LAT) of each payload. For
+    /// a Tx connection LAT is the time the payload was acknowledged.
+    GccgLatencyHistogram cot_to_lat_latency;
+
+    /// @brief Tx only. Number of payloads dropped by the tx_drop_late_enable option and completed with a status_code of
+    /// kGccgStatusDeadlineMissed.
+    uint64_t deadline_misses;
+
+    /// @brief Rx only. Number of lost packets that were recovered using the lossRecovery mode of the connection, by
+    /// retransmission or forward error correction.
+    uint64_t packets_recovered;
+
+    /// @brief Rx only. Number of lost packets that could not be recovered. A payload with an unrecovered packet is not
+    /// passed to the GccgRxCallback() callback API function.
+    uint64_t packets_lost;
+
+    /// @brief Number of transport lanes used by the connection. See the lanes object of connection_schema.json.
+    int lane_count;
+} GccgConnectionStats;
+
+/**
+ * Get the statistics of a Tx or Rx connection. The counters are maintained without locks on the data path, so this
+ * function can be called periodically without affecting transmission or reception. Individual counters are read
+ * atomically, but the set of counters is not a single atomic snapshot. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the create connection functions.
+ * @param ret_stats_ptr Pointer where to write the statistics.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgConnectionGetStats(GccgConnectionHandle handle, GccgConnectionStats* ret_stats_ptr);
+
+/**
+ * Get the latency value below which the given percentage of the values counted in a histogram fall. The returned value
+ * is the upper bound of the bucket that contains the percentile. This API is thread-safe.
+ *
+ * @param histogram_ptr Pointer to a histogram returned as part of GccgConnectionStats.
+ * @param percentile Percentile to get, in the range 0.0 to 100.0. For example 99.9.
+ * @param ret_microsecs_ptr Pointer where to write the latency value in microseconds.
+ *
+ * @return A value from the GccgReturnStatus enumeration. If the histogram is empty, then kGccgStatusInvalidParameter
+ *         will be returned.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgLatencyHistogramGetPercentile(const GccgLatencyHistogram* histogram_ptr,
+                                                                  double percentile,
+                                                                  uint64_t* ret_microsecs_ptr);
+
+/**
+ * @brief Type used to return the latency of a connection measured over a sliding window of recent payloads. Latency is
+ * measured from the Content Origination Timestamp (COT) to the Local Arrival Timestamp (LAT) of each payload and is
+ * tracked using a streaming quantile estimator, so the values are estimates.
+ */
+typedef struct {
+    /// @brief Length of the sliding window in milliseconds.
+    int window_milliseconds;
+
+    /// @brief Number of payloads measured within the window.
+    uint64_t sample_count;
+
+    /// @brief Minimum measured latency within the window, in microseconds.
+    uint64_t t_min_microsecs;
+
+    /// @brief 50th percentile of the measured latency within the window, in microseconds.
+    uint64_t t50_microsecs;
+
+    /// @brief 99th percentile of the measured latency within the window, in microseconds.
+    uint64_t t99_microsecs;
+
+    /// @brief Maximum measured latency within the window, in microseconds.
+    uint64_t t_max_microsecs;
+} GccgMeasuredTiming;
+
+/**
+ * @brief A structure of this type is passed as the parameter to GccgTimingCallback().
+ */
+typedef struct {
+    /// @brief The handle of the connection the measurement relates to.
+    GccgConnectionHandle connection_handle;
+
+    /// @brief The current measurement.
+    GccgMeasuredTiming timing;
+
+    /// @brief User defined callback parameter. This value is set as a parameter of the GccgConnectionSetTimingReport()
+    /// API function. The value is not modified by the SDK.
+    void* user_cb_param_ptr;
+} GccgTimingCbData;
+
+/**
+ * @brief Prototype of the measured timing callback function. It is invoked periodically once enabled using the
+ * GccgConnectionSetTimingReport() API function. The same threading rules as for the GccgRxCallback() callback API
+ * function apply.
+ *
+ * @param data_ptr A pointer to a GccgTimingCbData structure.
+ */
+typedef void (*GccgTimingCallback)(const GccgTimingCbData* data_ptr);
+
+/**
+ * Configure latency measurement of a connection. Measurement is always enabled, using a window of 10 seconds if this
+ * function is not called. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the create connection functions.
+ * @param window_milliseconds Length of the sliding window in milliseconds. Must be greater than zero.
+ * @param report_period_milliseconds Period in milliseconds at which timing_cb_ptr is invoked. Use zero to disable the
+ *                                   callback.
+ * @param timing_cb_ptr Address of the user function to call with each periodic measurement. May be NULL if
+ *                      report_period_milliseconds is zero.
+ * @param user_cb_param_ptr User defined callback parameter. This value is set as part of the GccgTimingCbData data
+ *                          whenever the timing_cb_ptr callback function is invoked. The value is not modified by the SDK.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgConnectionSetTimingReport(GccgConnectionHandle handle,
+                                                              int window_milliseconds,
+                                                              int report_period_milliseconds,
+                                                              GccgTimingCallback timing_cb_ptr,
+                                                              void* user_cb_param_ptr);
+
+/**
+ * Get the current latency measurement of a connection. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the create connection functions.
+ * @param ret_timing_ptr Pointer where to write the measurement.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgConnectionGetMeasuredTiming(GccgConnectionHandle handle,
+                                                                GccgMeasuredTiming* ret_timing_ptr);
+
+/**
+ * Get the returned connection json string of a connection, using tMin and tMax values derived from the current latency
+ * measurement. tMin is set from t_min_microsecs and tMax from t99_microsecs, both rounded up to whole milliseconds, and
+ * the measured key is set to true. The schema is the same as for ret_connection_json_str of the create connection
+ * functions. This API is thread-safe.
+ *
+ * @param handle Connection handle returned by one of the create connection functions.
+ * @param ret_connection_json_buffer_size Size of ret_connection_json_str buffer.
+ * @param ret_connection_json_str Pointer where to write returned json string. If size of buffer is not large enough,
+ *                                then kGccgStatusBufferToSmall will be returned.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgConnectionGetTimingJson(GccgConnectionHandle handle,
+                                                            int ret_connection_json_buffer_size,
+                                                            char* ret_connection_json_str);
+
+/**
+ * @brief Values used to identify the point in the life of a payload at which a trace event was recorded.
+ */
+typedef enum {
+    /// A payload was passed to GccgTxPayload() (or one of its variants). value is the payload size in bytes.
+    kGccgTracePointTxEnqueue        = 0,
+    /// The first packet of a payload was handed to the network interface.
+    kGccgTracePointTxWireStart      = 1,
+    /// The last packet of a payload was handed to the network interface.
+    kGccgTracePointTxWireEnd        = 2,
+    /// The first packet of a payload was received.
+    kGccgTracePointRxWireStart      = 3,
+    /// All packets of a payload were received. value is the payload size in bytes.
+    kGccgTracePointRxComplete       = 4,
+    /// The GccgTxCallback() or GccgRxCallback() callback API function is about to be invoked, or the completion posted
+    /// to a completion queue. value is the status_code.
+    kGccgTracePointCallbackEnter    = 5,
+    /// The GccgTxCallback() or GccgRxCallback() callback API function returned.
+    kGccgTracePointCallbackExit     = 6,
+    /// The media elements of a payload were freed using the GccgRxFreeBuffer() API function.
+    kGccgTracePointRxBufferFree     = 7,
+    /// First value available for events recorded by the application using GccgTraceRecord(). value is defined by the
+    /// application.
+    kGccgTracePointUser             = 256
+} GccgTracePoint;
+
+/**
+ * @brief Type used to define a single trace event, returned by the GccgTraceRead() API function.
+ */
+typedef struct {
+    /// @brief Time the event was recorded, from the same clock as GccgClockNow().
+    GccgTimestamp time;
+
+    /// @brief Point at which the event was recorded. See GccgTracePoint.
+    int trace_point;
+
+    /// @brief Operating system identifier of the thread that recorded the event.
+    int thread_id;
+
+    /// @brief Handle of the connection the payload belongs to.
+    GccgConnectionHandle connection_handle;
+
+    /// @brief Content Origination Timestamp (COT) of the payload. Together with the GMID of the connection, it
+    /// identifies the payload across hosts.
+    GccgTimestamp cot;
+
+    /// @brief Additional value. Its meaning depends on trace_point.
+    uint64_t value;
+} GccgTraceEvent;
+
+/**
+ * Start recording trace events. Each thread records events in its own lock-free ring buffer, so recording does not add
+ * contention to the data path. When a ring buffer is full, its oldest events are overwritten. Until this function is
+ * called, or after GccgTraceStop() is called, the cost of each trace point is a single predictable branch. This API is
+ * thread-safe.
+ *
+ * Implementations may also expose each trace point as a USDT probe, which can be used by external tracers independently
+ * of this function.
+ *
+ * @param ring_event_count Number of events held by the ring buffer of each thread. Must be greater than zero.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTraceStart(int ring_event_count);
+
+/**
+ * Stop recording trace events. Events already recorded are kept until they are read using GccgTraceRead() or a new
+ * recording is started. This API is thread-safe.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTraceStop(void);
+
+/**
+ * Record an application trace event, so that application processing appears in the same trace as the SDK trace
+ * points. Does nothing if recording is not started. Use the GCCG_TRACE_PROBE() macro to allow the call to be compiled
+ * out. This API is thread-safe.
+ *
+ * @param trace_point Trace point of the event. Must be kGccgTracePointUser or greater.
+ * @param handle Handle of the connection the payload belongs to. May be NULL.
+ * @param cot_ptr Pointer to the COT of the payload. May be NULL.
+ * @param value Application defined value.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTraceRecord(int trace_point,
+                                                GccgConnectionHandle handle,
+                                                const GccgTimestamp* cot_ptr,
+                                                uint64_t value);
+
+/**
+ * @brief Record an application trace event using GccgTraceRecord(). Compiles to nothing unless GCCG_ENABLE_TRACING is
+ * defined before this header is included.
+ */
+#ifdef GCCG_ENABLE_TRACING
+#define GCCG_TRACE_PROBE(trace_point, handle, cot_ptr, value) GccgTraceRecord((trace_point), (handle), (cot_ptr), (value))
+#else
+#define GCCG_TRACE_PROBE(trace_point, handle, cot_ptr, value) ((void)0)
+#endif
+
+/**
+ * Read and remove recorded trace events from the ring buffers of all threads, in time order. This API is thread-safe.
+ *
+ * @param ret_event_array Pointer to an array where to write the events.
+ * @param max_event_count Number of events ret_event_array can hold.
+ * @param ret_event_count_ptr Pointer where to write the number of events written to ret_event_array.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTraceRead(GccgTraceEvent* ret_event_array,
+                                              int max_event_count,
+                                              int* ret_event_count_ptr);
+
+/**
+ * Write all recorded trace events to a file in the Chrome trace event JSON format, which can be opened with Perfetto or
+ * chrome://tracing, and remove them from the ring buffers. Each payload is shown as a flow that connects its events,
+ * identified by connection and COT. This API is thread-safe.
+ *
+ * @param file_path_str Path of the file to write. An existing file is replaced.
+ *
+ * @return A value from the GccgReturnStatus enumeration.
+ */
+GCCG_INTERFACE GccgReturnStatus GccgTraceExportChrome(const char* file_path_str);
+
 #endif // GCCG_TRANSPORT_API_H__
@@ -0,0 +1,615 @@
+// -------------------------------------------------------------------------------------------
+// Copyright Amazon.com Inc. or its affiliates. All Rights Reserved.
+// This file is part of the VSF GCCG API, licensed under the BSD 2-Clause "Simplified" License.
+// License details at: https://github.com/vsf-tv/gccg-api/blob/mainline/LICENSE
+// -------------------------------------------------------------------------------------------
+
+#ifndef GCCG_TRANSPORT_API_HPP__
+#define GCCG_TRANSPORT_API_HPP__
+
+/**
+ * @file
+ * @brief
+ * This file defines a header-only C++20 coroutine layer over the GCCG transport API declared in gccg_transport_api.h.
+ * It hides the callback plumbing of the C API behind awaitable operations:
+ *
+ *     gccg::Task<void> Send(gccg::TxConnection& tx, GccgMediaElements elements)
+ *     {
+ *         GccgReturnStatus status = co_await tx.Send(payload_json_str, elements, timeout_microsecs);
+ *         ...
+ *     }
+ *
+ *     gccg::Task<void> Receive(gccg::RxConnection& rx)
+ *     {
+ *         gccg::RxPayload payload = co_await rx.Next();
+ *         ...
+ *     } // The media elements are freed using GccgRxFreeBuffer() when payload goes out of scope.
+ *
+ * No memory is allocated per operation. The state of each operation lives in the coroutine frame, received payloads
+ * are queued in a ring allocated when the connection is opened, and the frames of gccg::Task coroutines are reused from
+ * gccg::FramePool.
+ *
+ * Note: A coroutine awaiting an operation is resumed on the thread that invokes the callback function of the connection.
+ * In a multi-threaded configuration this is an SDK thread, and no further callback of the connection is invoked until
+ * the coroutine suspends again or completes. Long running work should therefore be moved to an application thread.
+ **/
+
+#include <stdint.h>
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "gccg_transport_api.h"
+
+namespace gccg {
+
+/**
+ * @brief Pool of coroutine frame memory. Freed frames are kept on per size-class free lists and reused by later
+ * coroutines, so that running a gccg::Task only allocates from the heap until the pool has warmed up. Frames larger than
+ * the largest size class are allocated from the heap directly.
+ */
+class FramePool {
+public:
+    static void* Allocate(std::size_t size)
+    {
+        std::size_t size_class = SizeClass(size);
+        if (size_class >= kSizeClassCount) {
+            return ::operator new(size);
+        }
+        {
+            std::lock_guard<std::mutex> lock(Mutex());
+            FreeFrame*& head_ptr = FreeList(size_class);
+            if (head_ptr != nullptr) {
+                FreeFrame* frame_ptr = head_ptr;
+                head_ptr = frame_ptr->next_ptr;
+                return frame_ptr;
+            }
+        }
+        return ::operator new((size_class + 1) * kSizeClassBytes);
+    }
+
+    static void Free(void* ptr, std::size_t size) noexcept
+    {
+        std::size_t size_class = SizeClass(size);
+        if (size_class >= kSizeClassCount) {
+            ::operator delete(ptr);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(Mutex());
+        FreeFrame*& head_ptr = FreeList(size_class);
+        FreeFrame* frame_ptr = static_cast<FreeFrame*>(ptr);
+        frame_ptr->next_ptr = head_ptr;
+        head_ptr = frame_ptr;
+    }
+
+private:
+    struct FreeFrame {
+        FreeFrame* next_ptr;
+    };
+
+    static constexpr std::size_t kSizeClassBytes = 256;
+    static constexpr std::size_t kSizeClassCount = 64;
+
+    static std::size_t SizeClass(std::size_t size) { return (size + kSizeClassBytes - 1) / kSizeClassBytes - 1; }
+
+    static std::mutex& Mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static FreeFrame*& FreeList(std::size_t size_class)
+    {
+        static FreeFrame* free_list_array[kSizeClassCount] = {};
+        return free_list_array[size_class];
+    }
+};
+
+template <typename T>
+class Task;
+
+namespace detail {
+
+class PromiseBase {
+public:
+    static void* operator new(std::size_t size) { return FramePool::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) noexcept { FramePool::Free(ptr, size); }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            PromiseBase& promise = handle.promise();
+            if (promise.continuation_) {
+                return promise.continuation_;
+            }
+            if (promise.detached_) {
+                handle.destroy();
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+    void RethrowIfException()
+    {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+
+    std::coroutine_handle<> continuation_;
+    bool detached_ = false;
+    std::exception_ptr exception_;
+};
+
+template <typename T>
+class Promise : public PromiseBase {
+public:
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    void return_value(U&& value)
+    {
+        ::new (static_cast<void*>(&storage_)) T(std::forward<U>(value));
+        has_value_ = true;
+    }
+
+    T TakeResult()
+    {
+        RethrowIfException();
+        return std::move(*std::launder(reinterpret_cast<T*>(&storage_)));
+    }
+
+    ~Promise()
+    {
+        if (has_value_) {
+            std::launder(reinterpret_cast<T*>(&storage_))->~T();
+        }
+    }
+
+private:
+    alignas(T) unsigned char storage_[sizeof(T)];
+    bool has_value_ = false;
+};
+
+template <>
+class Promise<void> : public PromiseBase {
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void TakeResult() { RethrowIfException(); }
+};
+
+} // namespace detail
+
+/**
+ * @brief Coroutine type whose frame is allocated from gccg::FramePool. A task does not start running until it is
+ * awaited, or started using Detach().
+ */
+template <typename T = void>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::Promise<T>;
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    ~Task() { Reset(); }
+
+    auto operator co_await() && noexcept
+    {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() noexcept { return false; }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                handle.promise().continuation_ = continuation;
+                return handle;
+            }
+
+            T await_resume() { return handle.promise().TakeResult(); }
+        };
+        return Awaiter{handle_};
+    }
+
+    /// @brief Start running the task without awaiting it. The frame is freed when the task completes. Exceptions thrown
+    /// by a detached task are ignored.
+    void Detach() &&
+    {
+        std::coroutine_handle<promise_type> handle = std::exchange(handle_, {});
+        handle.promise().detached_ = true;
+        handle.resume();
+    }
+
+private:
+    friend class detail::Promise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    void Reset() noexcept
+    {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = {};
+        }
+    }
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+inline Task<T> Promise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+} // namespace detail
+
+/**
+ * @brief Owner of a received payload. The media elements of the payload are freed using the GccgRxFreeBuffer() API
+ * function when the object is destroyed or Reset() is called.
+ */
+class RxPayload {
+public:
+    RxPayload() noexcept : data_() {}
+    explicit RxPayload(const GccgRxCbData& data) noexcept : data_(data) {}
+    RxPayload(RxPayload&& other) noexcept : data_(std::exchange(other.data_, GccgRxCbData())) {}
+    RxPayload(const RxPayload&) = delete;
+    RxPayload& operator=(const RxPayload&) = delete;
+    RxPayload& operator=(RxPayload&& other) noexcept
+    {
+        if (this != &other) {
+            Reset();
+            data_ = std::exchange(other.data_, GccgRxCbData());
+        }
+        return *this;
+    }
+    ~RxPayload() { Reset(); }
+
+    /// @brief The status_code of the GccgRxCbData. The other accessors return NULL values if it is not kGccgStatusOk.
+    GccgReturnStatus Status() const noexcept { return data_.status_code; }
+
+    const GccgMediaElements* MediaArray() const noexcept { return data_.media_array; }
+
+    const GccgPayloadInfo* PayloadInfo() const noexcept { return data_.payload_info_ptr; }
+
+    const char* PayloadJson() const noexcept { return data_.payload_json_str; }
+
+    /// @brief The complete GccgRxCbData, for example to pass to the GccgRxGetPayloadJson() API function.
+    const GccgRxCbData& Data() const noexcept { return data_; }
+
+    /// @brief Free the media elements of the payload now.
+    void Reset() noexcept
+    {
+        if (data_.media_array != nullptr) {
+            GccgRxFreeBuffer(const_cast<GccgMediaElements*>(data_.media_array));
+        }
+        data_ = GccgRxCbData();
+    }
+
+private:
+    GccgRxCbData data_;
+};
+
+/**
+ * @brief Owner of a transmitter connection. The connection is destroyed using the GccgConnectionDestroy() API function
+ * when the object is destroyed.
+ *
+ * No Send() may be outstanding when Close() is called or this object is destroyed: every coroutine awaiting Send() must
+ * have been resumed by its completion first. Completions of payloads still queued may not be delivered once the
+ * connection is destroyed, so their coroutines would never be resumed.
+ */
+class TxConnection {
+public:
+    TxConnection() = default;
+    TxConnection(const TxConnection&) = delete;
+    TxConnection& operator=(const TxConnection&) = delete;
+    ~TxConnection() { Close(); }
+
+    /// @brief Create the transmitter using the GccgTxConnectionCreateEx() API function. The completion_queue option
+    /// must not be set, since completions are delivered to the awaiting coroutines.
+    GccgReturnStatus Open(const char* connection_json_str,
+                          uint64_t tx_buffer_size_bytes,
+                          const GccgTxConnectionOptions* options_ptr,
+                          int ret_connection_json_buffer_size,
+                          char* ret_connection_json_str)
+    {
+        if (handle_ != nullptr || (options_ptr != nullptr && options_ptr->completion_queue != nullptr)) {
+            return kGccgStatusInvalidParameter;
+        }
+        return GccgTxConnectionCreateEx(connection_json_str, tx_buffer_size_bytes, &TxConnection::OnTxComplete,
+                                        options_ptr, ret_connection_json_buffer_size, ret_connection_json_str,
+                                        &buffer_ptr_, &handle_);
+    }
+
+    /// @brief Destroy the connection. No coroutine may be awaiting Send().
+    void Close() noexcept
+    {
+        if (handle_ != nullptr) {
+            GccgConnectionDestroy(handle_);
+            handle_ = nullptr;
+            buffer_ptr_ = nullptr;
+        }
+    }
+
+    GccgConnectionHandle Handle() const noexcept { return handle_; }
+
+    /// @brief Start of the transmit payload buffer returned when the connection was created.
+    void* Buffer() const noexcept { return buffer_ptr_; }
+
+    /// @brief Awaitable returned by Send(). The result of co_await is the status_code of the completion, or the status
+    /// of the failed GccgTxPayload() or GccgTxPayloadEx() call if the payload could not be queued.
+    class SendAwaiter {
+    public:
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            handle_ = handle;
+            // Without binary payload information the timing values are taken from the json string by GccgTxPayload().
+            GccgReturnStatus status =
+                payload_info_ptr_ == nullptr
+                    ? GccgTxPayload(connection_handle_, payload_json_str_, media_array_, this, timeout_microsecs_)
+                    : GccgTxPayloadEx(connection_handle_, payload_info_ptr_, payload_json_str_, media_array_, this,
+                                      timeout_microsecs_);
+            if (status != kGccgStatusOk) {
+                // The callback is never invoked, so this object is still owned by the suspending coroutine.
+                completion_ = GccgTxCbData();
+                completion_.status_code = status;
+                return false;
+            }
+            // The callback may already have resumed the coroutine and destroyed this object, so it must not be touched.
+            return true;
+        }
+
+        GccgReturnStatus await_resume() const noexcept { return completion_.status_code; }
+
+        /// @brief The complete GccgTxCbData of the completion, valid after co_await returns.
+        const GccgTxCbData& Completion() const noexcept { return completion_; }
+
+    private:
+        friend class TxConnection;
+
+        SendAwaiter(GccgConnectionHandle connection_handle,
+                    const GccgPayloadInfo* payload_info_ptr,
+                    const char* payload_json_str,
+                    GccgMediaElements media_array,
+                    int timeout_microsecs) noexcept
+            : connection_handle_(connection_handle),
+              payload_info_ptr_(payload_info_ptr),
+              payload_json_str_(payload_json_str),
+              media_array_(media_array),
+              timeout_microsecs_(timeout_microsecs),
+              completion_()
+        {
+        }
+
+        GccgConnectionHandle connection_handle_;
+        const GccgPayloadInfo* payload_info_ptr_;
+        const char* payload_json_str_;
+        GccgMediaElements media_array_;
+        int timeout_microsecs_;
+        std::coroutine_handle<> handle_;
+        GccgTxCbData completion_;
+    };
+
+    /// @brief Transmit a payload using the GccgTxPayload() API function, with the timing values taken from
+    /// payload_json_str. The strings and media elements must remain valid until co_await returns.
+    SendAwaiter Send(const char* payload_json_str, GccgMediaElements media_array, int timeout_microsecs) noexcept
+    {
+        return SendAwaiter(handle_, nullptr, payload_json_str, media_array, timeout_microsecs);
+    }
+
+    /// @brief Transmit a payload using binary payload information, see the GccgTxPayloadEx() API function.
+    SendAwaiter Send(const GccgPayloadInfo* payload_info_ptr,
+                     const char* payload_json_str,
+                     GccgMediaElements media_array,
+                     int timeout_microsecs) noexcept
+    {
+        return SendAwaiter(handle_, payload_info_ptr, payload_json_str, media_array, timeout_microsecs);
+    }
+
+private:
+    static void OnTxComplete(const GccgTxCbData* data_ptr)
+    {
+        SendAwaiter* awaiter_ptr = static_cast<SendAwaiter*>(data_ptr->user_cb_param_ptr);
+        awaiter_ptr->completion_ = *data_ptr;
+        awaiter_ptr->handle_.resume();
+    }
+
+    GccgConnectionHandle handle_ = nullptr;
+    void* buffer_ptr_ = nullptr;
+};
+
+/**
+ * @brief Owner of a receiver connection. The connection is destroyed using the GccgConnectionDestroy() API function
+ * when the object is destroyed. Payloads that arrive while no coroutine is awaiting Next() are queued in a ring whose
+ * capacity is set when the connection is opened. If the ring is full, the payload is freed and counted by
+ * DroppedCount(). A capacity at least equal to the number of receive slots of the connection avoids this.
+ *
+ * RxPayload objects returned by Next() must be destroyed or Reset() before Close() is called or this object is
+ * destroyed, since their media elements cannot be freed once the connection has been destroyed.
+ *
+ * The object must not be moved once opened, since its address is passed to the SDK as the callback parameter.
+ */
+class RxConnection {
+public:
+    RxConnection() = default;
+    RxConnection(const RxConnection&) = delete;
+    RxConnection& operator=(const RxConnection&) = delete;
+    ~RxConnection() { Close(); }
+
+    /// @brief Create the receiver using the GccgRxConnectionCreateEx() API function. The completion_queue option must not
+    /// be set, since payloads are delivered to the awaiting coroutines.
+    GccgReturnStatus Open(const char* connection_json_str,
+                          uint64_t rx_buffer_size_bytes,
+                          const GccgRxConnectionOptions* options_ptr,
+                          int queue_capacity,
+                          int ret_connection_json_buffer_size,
+                          char* ret_connection_json_str)
+    {
+        if (handle_ != nullptr || queue_capacity < 1 ||
+            (options_ptr != nullptr && options_ptr->completion_queue != nullptr)) {
+            return kGccgStatusInvalidParameter;
+        }
+        queue_.assign(static_cast<std::size_t>(queue_capacity), GccgRxCbData());
+        queue_head_ = 0;
+        queue_count_ = 0;
+        dropped_count_ = 0;
+        closing_ = false;
+        return GccgRxConnectionCreateEx(connection_json_str, rx_buffer_size_bytes, &RxConnection::OnRxComplete, this,
+                                        options_ptr, ret_connection_json_buffer_size, ret_connection_json_str,
+                                        &handle_);
+    }
+
+    /// @brief Free any queued payloads and destroy the connection. No coroutine may be awaiting Next(), and all
+    /// RxPayload objects of the connection must have been released.
+    void Close() noexcept
+    {
+        if (handle_ == nullptr) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closing_ = true;
+        }
+        // Payloads arriving from now on are freed by OnRxComplete(), so the queue only shrinks.
+        for (;;) {
+            GccgRxCbData data;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (queue_count_ == 0) {
+                    break;
+                }
+                data = Pop();
+            }
+            RxPayload payload(data);
+        }
+        GccgConnectionDestroy(handle_);
+        handle_ = nullptr;
+    }
+
+    GccgConnectionHandle Handle() const noexcept { return handle_; }
+
+    /// @brief Number of payloads freed because the ring was full.
+    uint64_t DroppedCount() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dropped_count_;
+    }
+
+    /// @brief Awaitable returned by Next(). The result of co_await is the next received payload.
+    class NextAwaiter {
+    public:
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            std::lock_guard<std::mutex> lock(connection_ptr_->mutex_);
+            if (connection_ptr_->queue_count_ > 0) {
+                data_ = connection_ptr_->Pop();
+                return false;
+            }
+            handle_ = handle;
+            connection_ptr_->waiter_ptr_ = this;
+            return true;
+        }
+
+        RxPayload await_resume() noexcept { return RxPayload(data_); }
+
+    private:
+        friend class RxConnection;
+
+        explicit NextAwaiter(RxConnection* connection_ptr) noexcept : connection_ptr_(connection_ptr), data_() {}
+
+        RxConnection* connection_ptr_;
+        std::coroutine_handle<> handle_;
+        GccgRxCbData data_;
+    };
+
+    /// @brief Wait for the next received payload. Only one coroutine may await Next() at a time.
+    NextAwaiter Next() noexcept { return NextAwaiter(this); }
+
+private:
+    static void OnRxComplete(const GccgRxCbData* data_ptr)
+    {
+        RxConnection* connection_ptr = static_cast<RxConnection*>(data_ptr->user_cb_param_ptr);
+        NextAwaiter* waiter_ptr = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(connection_ptr->mutex_);
+            waiter_ptr = std::exchange(connection_ptr->waiter_ptr_, nullptr);
+            if (waiter_ptr == nullptr && !connection_ptr->closing_) {
+                if (connection_ptr->queue_count_ < connection_ptr->queue_.size()) {
+                    std::size_t tail = (connection_ptr->queue_head_ + connection_ptr->queue_count_) %
+                                       connection_ptr->queue_.size();
+                    connection_ptr->queue_[tail] = *data_ptr;
+                    connection_ptr->queue_count_++;
+                    return;
+                }
+                connection_ptr->dropped_count_++;
+            }
+        }
+        if (waiter_ptr == nullptr) {
+            RxPayload dropped(*data_ptr);
+            return;
+        }
+        waiter_ptr->data_ = *data_ptr;
+        waiter_ptr->handle_.resume();
+    }
+
+    /// @brief Remove the oldest queued payload. The mutex must be held, or no callback may be running.
+    GccgRxCbData Pop() noexcept
+    {
+        GccgRxCbData data = queue_[queue_head_];
+        queue_head_ = (queue_head_ + 1) % queue_.size();
+        queue_count_--;
+        return data;
+    }
+
+    GccgConnectionHandle handle_ = nullptr;
+    mutable std::mutex mutex_;
+    std::vector<GccgRxCbData> queue_;
+    std::size_t queue_head_ = 0;
+    std::size_t queue_count_ = 0;
+    uint64_t dropped_count_ = 0;
+    bool closing_ = false;
+    NextAwaiter* waiter_ptr_ = nullptr;
+};
+
+} // namespace gccg
+
+#endif // GCCG_TRANSPORT_API_HPP__